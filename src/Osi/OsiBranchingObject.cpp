@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 //#define OSI_DEBUG
 #include "OsiSolverInterface.hpp"
 #include "OsiBranchingObject.hpp"
@@ -66,6 +67,15 @@ OsiObject::downEstimate() const
 {
   return 1.0e-5;
 }
+// Create branch, reusing an old one if possible (default can't)
+OsiBranchingObject *
+OsiObject::recreateBranch(OsiBranchingObject *branch,
+  OsiSolverInterface *solver, const OsiBranchingInformation *info,
+  int way) const
+{
+  delete branch;
+  return createBranch(solver, info, way);
+}
 // Column number if single column object -1 otherwise
 int OsiObject::columnNumber() const
 {
@@ -136,6 +146,15 @@ OsiObject2::operator=(const OsiObject2 &rhs)
   }
   return *this;
 }
+// Infeasibility without changing mutable stuff
+double
+OsiObject2::checkInfeasibility(const OsiBranchingInformation *info) const
+{
+  double saveOtherInfeasibility = otherInfeasibility_;
+  double value = OsiObject::checkInfeasibility(info);
+  otherInfeasibility_ = saveOtherInfeasibility;
+  return value;
+}
 // Default Constructor
 OsiBranchingObject::OsiBranchingObject()
 {
@@ -181,6 +200,43 @@ OsiBranchingObject::operator=(const OsiBranchingObject &rhs)
 OsiBranchingObject::~OsiBranchingObject()
 {
 }
+//#############################################################################
+// OsiBoundJournal
+//#############################################################################
+OsiBoundJournal::OsiBoundJournal()
+  : columns_()
+  , lower_()
+  , upper_()
+  , complete_(true)
+{
+}
+void OsiBoundJournal::record(const OsiSolverInterface *solver, int iColumn)
+{
+  columns_.push_back(iColumn);
+  lower_.push_back(solver->getColLower()[iColumn]);
+  upper_.push_back(solver->getColUpper()[iColumn]);
+}
+// Latest first so a column recorded twice gets its first bounds back
+void OsiBoundJournal::restore(OsiSolverInterface *solver)
+{
+  const double *lower = solver->getColLower();
+  const double *upper = solver->getColUpper();
+  for (int i = static_cast< int >(columns_.size()) - 1; i >= 0; i--) {
+    int iColumn = columns_[i];
+    if (lower[iColumn] != lower_[i])
+      solver->setColLower(iColumn, lower_[i]);
+    if (upper[iColumn] != upper_[i])
+      solver->setColUpper(iColumn, upper_[i]);
+  }
+  clear();
+}
+void OsiBoundJournal::clear()
+{
+  columns_.clear();
+  lower_.clear();
+  upper_.clear();
+  complete_ = true;
+}
 // For debug
 int OsiBranchingObject::columnNumber() const
 {
@@ -583,6 +639,33 @@ OsiSimpleInteger::infeasibility(const OsiBranchingInformation *info, int &whichW
   return returnValue;
 }
 
+// Infeasibility of a block of simple integers
+/* The tests on lower and whichWay do not change in the loop, so there is
+   no branch on the data and compilers which can vectorize floor will. */
+int OsiSimpleInteger::infeasibilities(int number, const int *columns,
+  const double *solution, const double *lower, const double *upper,
+  double tolerance, double *infeasibility, int *whichWay)
+{
+  int numberInfeasible = 0;
+  for (int i = 0; i < number; i++) {
+    int iColumn = columns[i];
+    double value = solution[iColumn];
+    if (lower) {
+      value = CoinMax(value, lower[iColumn]);
+      value = CoinMin(value, upper[iColumn]);
+    }
+    double nearest = floor(value + (1.0 - 0.5));
+    if (whichWay)
+      whichWay[i] = nearest > value ? 1 : 0;
+    double away = fabs(value - nearest);
+    // a NaN is passed through, as in infeasibility()
+    away = away <= tolerance ? 0.0 : away;
+    infeasibility[i] = away;
+    numberInfeasible += away > 0.0 ? 1 : 0;
+  }
+  return numberInfeasible;
+}
+
 // This looks at solution and sets bounds to contain solution
 /** More precisely: it first forces the variable within the existing
     bounds, and then tightens the bounds to fix the variable at the
@@ -624,6 +707,23 @@ OsiSimpleInteger::createBranch(OsiSolverInterface *solver, const OsiBranchingInf
     value);
   return branch;
 }
+// Creates a branching object in place of an old one if the same class
+OsiBranchingObject *
+OsiSimpleInteger::recreateBranch(OsiBranchingObject *branch,
+  OsiSolverInterface *solver, const OsiBranchingInformation *info,
+  int way) const
+{
+  // a derived class may override createBranch(), so only reuse for this one
+  if (!branch || typeid(*this) != typeid(OsiSimpleInteger)
+    || typeid(*branch) != typeid(OsiIntegerBranchingObject))
+    return OsiObject::recreateBranch(branch, solver, info, way);
+  double value = info->solution_[columnNumber_];
+  value = CoinMax(value, info->lower_[columnNumber_]);
+  value = CoinMin(value, info->upper_[columnNumber_]);
+  assert(info->upper_[columnNumber_] > info->lower_[columnNumber_]);
+  *static_cast< OsiIntegerBranchingObject * >(branch) = OsiIntegerBranchingObject(solver, this, way, value);
+  return branch;
+}
 // Return "down" estimate
 double
 OsiSimpleInteger::downEstimate() const
@@ -731,9 +831,22 @@ OsiIntegerBranchingObject::~OsiIntegerBranchingObject()
 double
 OsiIntegerBranchingObject::branch(OsiSolverInterface *solver)
 {
+  return branch(solver, NULL);
+}
+double
+OsiIntegerBranchingObject::branch(OsiSolverInterface *solver,
+  OsiBoundJournal *journal)
+{
+  if (journal && typeid(*this) != typeid(OsiIntegerBranchingObject)) {
+    // a derived class may override branch(solver), so let it branch
+    journal->setIncomplete();
+    return branch(solver);
+  }
   const OsiSimpleInteger *obj = dynamic_cast< const OsiSimpleInteger * >(originalObject_);
   assert(obj);
   int iColumn = obj->columnNumber();
+  if (journal)
+    journal->record(solver, iColumn);
   double olb, oub;
   olb = solver->getColLower()[iColumn];
   oub = solver->getColUpper()[iColumn];
@@ -1346,6 +1459,17 @@ OsiSOSBranchingObject::~OsiSOSBranchingObject()
 double
 OsiSOSBranchingObject::branch(OsiSolverInterface *solver)
 {
+  return branch(solver, NULL);
+}
+double
+OsiSOSBranchingObject::branch(OsiSolverInterface *solver,
+  OsiBoundJournal *journal)
+{
+  if (journal && typeid(*this) != typeid(OsiSOSBranchingObject)) {
+    // a derived class may override branch(solver), so let it branch
+    journal->setIncomplete();
+    return branch(solver);
+  }
   const OsiSOS *set = dynamic_cast< const OsiSOS * >(originalObject_);
   assert(set);
   int way = (!branchIndex_) ? (2 * firstBranch_ - 1) : -(2 * firstBranch_ - 1);
@@ -1363,15 +1487,19 @@ OsiSOSBranchingObject::branch(OsiSolverInterface *solver)
         break;
     }
     assert(i < numberMembers);
-    for (; i < numberMembers; i++)
+    for (; i < numberMembers; i++) {
+      if (journal)
+        journal->record(solver, which[i]);
       solver->setColUpper(which[i], 0.0);
+    }
   } else {
     int i;
     for (i = 0; i < numberMembers; i++) {
       if (weights[i] >= value_)
         break;
-      else
-        solver->setColUpper(which[i], 0.0);
+      if (journal)
+        journal->record(solver, which[i]);
+      solver->setColUpper(which[i], 0.0);
     }
     assert(i < numberMembers);
   }
@@ -1934,9 +2062,22 @@ OsiLotsizeBranchingObject::~OsiLotsizeBranchingObject()
 double
 OsiLotsizeBranchingObject::branch(OsiSolverInterface *solver)
 {
+  return branch(solver, NULL);
+}
+double
+OsiLotsizeBranchingObject::branch(OsiSolverInterface *solver,
+  OsiBoundJournal *journal)
+{
+  if (journal && typeid(*this) != typeid(OsiLotsizeBranchingObject)) {
+    // a derived class may override branch(solver), so let it branch
+    journal->setIncomplete();
+    return branch(solver);
+  }
   const OsiLotsize *obj = dynamic_cast< const OsiLotsize * >(originalObject_);
   assert(obj);
   int iColumn = obj->columnNumber();
+  if (journal)
+    journal->record(solver, iColumn);
   int way = (!branchIndex_) ? (2 * firstBranch_ - 1) : -(2 * firstBranch_ - 1);
   if (way < 0) {
 #ifdef OSI_DEBUG
@@ -124,6 +124,18 @@ public:
     throw CoinError("Need code", "createBranch", "OsiBranchingObject");
     return NULL;
   }
+  /** As createBranch, but \p branch (made earlier, may be NULL) may be
+      reused.
+
+      Returns the branching object, which is \p branch if that could be
+      reused; otherwise \p branch is deleted.  This lets callers which
+      create a branch for many candidates (strong branching) avoid a heap
+      allocation each time.  The default just deletes \p branch and calls
+      createBranch.
+  */
+  virtual OsiBranchingObject *recreateBranch(OsiBranchingObject *branch,
+    OsiSolverInterface *solver, const OsiBranchingInformation *info,
+    int way) const;
 
   /** \brief Return true if object can take part in normal heuristics
   */
@@ -257,6 +269,10 @@ public:
     return preferredWay_;
   }
 
+  using OsiObject::checkInfeasibility;
+  /// As OsiObject but other way infeasibility is left alone too
+  virtual double checkInfeasibility(const OsiBranchingInformation *info) const;
+
 protected:
   /// Preferred way of branching - -1 off, 0 down, 1 up (for 2-way)
   int preferredWay_;
@@ -264,6 +280,55 @@ protected:
   mutable double otherInfeasibility_;
 };
 
+/** \brief Sparse record of column bounds changed by branching
+
+  OsiBranchingObject::branch(solver, journal) saves the bounds of each
+  column it is about to change, so that restore() can undo the branch at
+  a cost proportional to the number of changes rather than the number of
+  columns.  A branching object which cannot say what it changed marks the
+  journal incomplete, and the caller must then restore bounds some other
+  way.
+*/
+class OSILIB_EXPORT OsiBoundJournal {
+
+public:
+  /// Default Constructor
+  OsiBoundJournal();
+
+  /// Save current bounds of column iColumn (call before changing them)
+  void record(const OsiSolverInterface *solver, int iColumn);
+  /// Say bounds were changed without being recorded
+  inline void setIncomplete()
+  {
+    complete_ = false;
+  }
+  /// True if all bound changes since clear() were recorded
+  inline bool complete() const
+  {
+    return complete_;
+  }
+  /// Number of columns recorded
+  inline int numberEntries() const
+  {
+    return static_cast< int >(columns_.size());
+  }
+  /** Put back recorded bounds (latest first) and clear.
+      Only unrecorded changes are left if not complete(). */
+  void restore(OsiSolverInterface *solver);
+  /// Forget all entries and mark complete
+  void clear();
+
+private:
+  /// Columns in order recorded
+  std::vector< int > columns_;
+  /// Lower bounds before change
+  std::vector< double > lower_;
+  /// Upper bounds before change
+  std::vector< double > upper_;
+  /// False if changes were made without recording
+  bool complete_;
+};
+
 /** \brief Abstract branching object base class
 
   In the abstract, an OsiBranchingObject contains instructions for how to
@@ -346,6 +411,16 @@ public:
 	     Returns change in guessed objective on next branch
   */
   virtual double branch() { return branch(NULL); }
+  /** \brief As branch(solver) but bounds are saved in \p journal before
+	     they are changed (if \p journal is not NULL).
+	     The default just marks the journal incomplete.
+  */
+  virtual double branch(OsiSolverInterface *solver, OsiBoundJournal *journal)
+  {
+    if (journal)
+      journal->setIncomplete();
+    return branch(solver);
+  }
   /** \brief Return true if branch should fix variables
   */
   virtual bool boundBranch() const
@@ -584,6 +659,20 @@ public:
   using OsiObject::infeasibility;
   /// Infeasibility - large is 0.5
   virtual double infeasibility(const OsiBranchingInformation *info, int &whichWay) const;
+  /** Infeasibility of many simple integers in one pass.
+
+      For each of the \p number columns in \p columns this computes what
+      infeasibility() returns when shadow prices are not in use, without a
+      virtual call per column.  The value is first moved inside \p lower and
+      \p upper (unless they are NULL).  \p infeasibility gets the distance
+      to the nearest integer, or zero if that is not above \p tolerance, and
+      \p whichWay (if not NULL) the nearer way, ignoring preferredWay().
+      Mutable data in the objects is not touched.  Returns the number with
+      positive infeasibility.
+  */
+  static int infeasibilities(int number, const int *columns,
+    const double *solution, const double *lower, const double *upper,
+    double tolerance, double *infeasibility, int *whichWay = NULL);
 
   using OsiObject::feasibleRegion;
   /** Set bounds to fix the variable at the current (integer) value.
@@ -599,6 +688,12 @@ public:
   */
   virtual OsiBranchingObject *createBranch(OsiSolverInterface *solver, const OsiBranchingInformation *info, int way) const;
 
+  /** Reuses \p branch if it is exactly an OsiIntegerBranchingObject and
+      this is exactly an OsiSimpleInteger (else as OsiObject) */
+  virtual OsiBranchingObject *recreateBranch(OsiBranchingObject *branch,
+    OsiSolverInterface *solver, const OsiBranchingInformation *info,
+    int way) const;
+
   /// Set solver column number
   inline void setColumnNumber(int value)
   {
@@ -707,6 +802,10 @@ public:
 	     Returns change in guessed objective on next branch
   */
   virtual double branch(OsiSolverInterface *solver);
+  /** As branch(solver) recording the bounds changed in \p journal.
+      For a derived class (which may override branch(solver)) the journal
+      is marked incomplete and branch(solver) is called. */
+  virtual double branch(OsiSolverInterface *solver, OsiBoundJournal *journal);
 
   using OsiBranchingObject::print;
   /** \brief Print something about branch - only if log level high
@@ -892,6 +991,10 @@ public:
   using OsiBranchingObject::branch;
   /// Does next branch and updates state
   virtual double branch(OsiSolverInterface *solver);
+  /** As branch(solver) recording the bounds changed in \p journal.
+      For a derived class (which may override branch(solver)) the journal
+      is marked incomplete and branch(solver) is called. */
+  virtual double branch(OsiSolverInterface *solver, OsiBoundJournal *journal);
 
   using OsiBranchingObject::print;
   /** \brief Print something about branch - only if log level high
@@ -1081,6 +1184,10 @@ public:
 	     Returns change in guessed objective on next branch
   */
   virtual double branch(OsiSolverInterface *solver);
+  /** As branch(solver) recording the bounds changed in \p journal.
+      For a derived class (which may override branch(solver)) the journal
+      is marked incomplete and branch(solver) is called. */
+  virtual double branch(OsiSolverInterface *solver, OsiBoundJournal *journal);
 
   using OsiBranchingObject::print;
   /** \brief Print something about branch - only if log level high
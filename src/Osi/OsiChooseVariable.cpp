@@ -2,10 +2,12 @@
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
+#include <algorithm>
 #include <string>
 #include <cassert>
 #include <cfloat>
 #include <cmath>
+#include <typeinfo>
 #include "CoinPragma.hpp"
 #include "OsiSolverInterface.hpp"
 #include "OsiAuxInfo.hpp"
@@ -16,6 +18,10 @@
 #include "CoinSort.hpp"
 #include "CoinFinite.hpp"
 #include "OsiChooseVariable.hpp"
+#include "OsiSharedPseudoCosts.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 using namespace std;
 
 OsiChooseVariable::OsiChooseVariable()
@@ -39,6 +45,8 @@ OsiChooseVariable::OsiChooseVariable()
   , numberStrongFixed_(0)
   , trustStrongForBound_(true)
   , trustStrongForSolution_(true)
+  , simpleIntegerObjects_(NULL)
+  , simpleIntegerNumberObjects_(0)
 {
 }
 
@@ -61,6 +69,8 @@ OsiChooseVariable::OsiChooseVariable(const OsiSolverInterface *solver)
   , numberStrongFixed_(0)
   , trustStrongForBound_(true)
   , trustStrongForSolution_(true)
+  , simpleIntegerObjects_(NULL)
+  , simpleIntegerNumberObjects_(0)
 {
   // create useful arrays
   int numberObjects = solver_->numberObjects();
@@ -86,6 +96,8 @@ OsiChooseVariable::OsiChooseVariable(const OsiChooseVariable &rhs)
   numberStrongFixed_ = rhs.numberStrongFixed_;
   trustStrongForBound_ = rhs.trustStrongForBound_;
   trustStrongForSolution_ = rhs.trustStrongForSolution_;
+  simpleIntegerObjects_ = NULL;
+  simpleIntegerNumberObjects_ = 0;
   solver_ = rhs.solver_;
   if (solver_) {
     int numberObjects = solver_->numberObjects();
@@ -127,6 +139,10 @@ OsiChooseVariable::operator=(const OsiChooseVariable &rhs)
     numberStrongFixed_ = rhs.numberStrongFixed_;
     trustStrongForBound_ = rhs.trustStrongForBound_;
     trustStrongForSolution_ = rhs.trustStrongForSolution_;
+    simpleIntegerObjects_ = NULL;
+    simpleIntegerNumberObjects_ = 0;
+    simpleIntegerColumns_.clear();
+    simpleIntegerInfeasibility_.clear();
     solver_ = rhs.solver_;
     if (solver_) {
       int numberObjects = solver_->numberObjects();
@@ -170,6 +186,32 @@ void OsiChooseVariable::setSolver(const OsiSolverInterface *solver)
   int numberObjects = solver_->numberObjects();
   list_ = new int[numberObjects];
   useful_ = new double[numberObjects];
+  simpleIntegerObjects_ = NULL;
+}
+// Infeasibilities of leading simple integers
+int OsiChooseVariable::simpleIntegerInfeasibilities(const OsiBranchingInformation *info)
+{
+  if (info->defaultDual_ >= 0.0)
+    return 0; // shadow prices - the objects must do it
+  int numberObjects = info->solver_->numberObjects();
+  const OsiObject *const *object = info->solver_->objects();
+  if (object != simpleIntegerObjects_ || numberObjects != simpleIntegerNumberObjects_) {
+    simpleIntegerObjects_ = object;
+    simpleIntegerNumberObjects_ = numberObjects;
+    simpleIntegerColumns_.clear();
+    for (int i = 0; i < numberObjects; i++) {
+      if (typeid(*object[i]) != typeid(OsiSimpleInteger))
+        break;
+      simpleIntegerColumns_.push_back(object[i]->columnNumber());
+    }
+    simpleIntegerInfeasibility_.resize(simpleIntegerColumns_.size());
+  }
+  int number = static_cast< int >(simpleIntegerColumns_.size());
+  if (number)
+    OsiSimpleInteger::infeasibilities(number, &simpleIntegerColumns_[0],
+      info->solution_, info->lower_, info->upper_, info->integerTolerance_,
+      &simpleIntegerInfeasibility_[0]);
+  return number;
 }
 
 // Initialize
@@ -201,11 +243,16 @@ int OsiChooseVariable::setupList(OsiBranchingInformation *info, bool initialize)
     useful_[i] = 0.0;
   }
   OsiObject **object = info->solver_->objects();
+  // simple integers in one pass - objects only asked if unsatisfied
+  int numberSimple = simpleIntegerInfeasibilities(info);
+  const double *simpleInfeasibility = numberSimple ? &simpleIntegerInfeasibility_[0] : NULL;
   // Say feasible
   bool feasible = true;
   for (i = 0; i < numberObjects; i++) {
     int way;
-    double value = object[i]->infeasibility(info, way);
+    double value = i < numberSimple ? simpleInfeasibility[i] : 1.0;
+    if (value > 0.0)
+      value = object[i]->infeasibility(info, way);
     if (value > 0.0) {
       numberUnsatisfied_++;
       if (value == COIN_DBL_MAX) {
@@ -316,9 +363,22 @@ bool OsiChooseVariable::feasibleSolution(const OsiBranchingInformation *info,
   const OsiObject **objects)
 {
   bool satisfied = true;
+  /* Simple integers found by setupList in one pass.  This only reads
+     what was found there, so it may be called from several threads. */
+  int numberSimple = 0;
+  if (info->defaultDual_ < 0.0 && objects == simpleIntegerObjects_
+    && numberObjects == simpleIntegerNumberObjects_)
+    numberSimple = static_cast< int >(simpleIntegerColumns_.size());
+  if (numberSimple) {
+    std::vector< double > infeasibility(numberSimple);
+    if (OsiSimpleInteger::infeasibilities(numberSimple, &simpleIntegerColumns_[0],
+          solution, info->lower_, info->upper_, info->integerTolerance_,
+          &infeasibility[0]))
+      return false;
+  }
   const double *saveSolution = info->solution_;
   info->solution_ = solution;
-  for (int i = 0; i < numberObjects; i++) {
+  for (int i = numberSimple; i < numberObjects; i++) {
     double value = objects[i]->checkInfeasibility(info);
     if (value > 0.0) {
       satisfied = false;
@@ -336,6 +396,13 @@ void OsiChooseVariable::saveSolution(const OsiSolverInterface *solver)
   goodSolution_ = CoinCopyOfArray(solver->getColSolution(), numberColumns);
   goodObjectiveValue_ = solver->getObjSense() * solver->getObjValue();
 }
+void OsiChooseVariable::saveSolution(const double *solution,
+  int numberColumns, double objectiveValue)
+{
+  delete[] goodSolution_;
+  goodSolution_ = CoinCopyOfArray(solution, numberColumns);
+  goodObjectiveValue_ = objectiveValue;
+}
 // Clears out good solution after use
 void OsiChooseVariable::clearGoodSolution()
 {
@@ -344,6 +411,20 @@ void OsiChooseVariable::clearGoodSolution()
   goodObjectiveValue_ = COIN_DBL_MAX;
 }
 
+namespace {
+// Status of a strong branch as OsiHotInfo sees it (0 optimal, 1 infeasible, 2 not finished)
+int strongBranchStatus(const OsiSolverInterface *solver)
+{
+  if (solver->isProvenOptimal())
+    return 0;
+  else if (solver->isIterationLimitReached()
+    && !solver->isDualObjectiveLimitReached())
+    return 2;
+  else
+    return 1;
+}
+}
+
 /*  This is a utility function which does strong branching on
     a list of objects and stores the results in OsiHotInfo.objects.
     On entry the object sequence is stored in the OsiHotInfo object
@@ -359,104 +440,157 @@ int OsiChooseStrong::doStrongBranching(OsiSolverInterface *solver,
   OsiBranchingInformation *info,
   int numberToDo, int returnCriterion)
 {
+#ifdef _OPENMP
+  if (numberThreads_ > 1 && numberToDo > 1)
+    return doStrongBranchingParallel(solver, info, numberToDo, returnCriterion);
+#endif
 
-  // Might be faster to extend branch() to return bounds changed
-  double *saveLower = NULL;
-  double *saveUpper = NULL;
   int numberColumns = solver->getNumCols();
   solver->markHotStart();
   const double *lower = info->lower_;
   const double *upper = info->upper_;
-  saveLower = CoinCopyOfArray(info->lower_, numberColumns);
-  saveUpper = CoinCopyOfArray(info->upper_, numberColumns);
+  // kept in the chooser so there is no allocation from node to node
+  saveLower_.assign(info->lower_, info->lower_ + numberColumns);
+  saveUpper_.assign(info->upper_, info->upper_ + numberColumns);
+  const double *saveLower = &saveLower_[0];
+  const double *saveUpper = &saveUpper_[0];
   numResults_ = 0;
   int returnCode = 0;
   double timeStart = CoinCpuTime();
+  // bounds changed by each branch so only those need to be put back
+  OsiBoundJournal &journal = journal_;
+  journal.clear();
+  // results kept from an earlier call at this node
+  bool reuseCache;
+  int cacheIndex = cacheNode(solver, info, reuseCache);
+  int iterationLimit = 0;
+  if (strongStatistics_) {
+    solver->getIntParam(OsiMaxNumIterationHotStart, iterationLimit);
+    numberStrongCalls_++;
+  }
   for (int iDo = 0; iDo < numberToDo; iDo++) {
     OsiHotInfo *result = results_ + iDo;
+    double candidateStart = strongStatistics_ ? CoinWallclockTime() : 0.0;
     // For now just 2 way
     OsiBranchingObject *branch = result->branchingObject();
     assert(branch->numberBranches() == 2);
-    /*
-      Try the first direction.  Each subsequent call to branch() performs the
-      specified branch and advances the branch object state to the next branch
-      alternative.)
-    */
-    OsiSolverInterface *thisSolver = solver;
-    if (branch->boundBranch()) {
-      // ordinary
-      branch->branch(solver);
-      // maybe we should check bounds for stupidities here?
-      solver->solveFromHotStart();
+    int status0;
+    int status1;
+    const StrongCacheResult *cached = reuseCache ? findCacheResult(cacheIndex, result) : NULL;
+    if (cached) {
+      // same node, same candidate - as if solved again
+      status0 = result->updateInformation(info, this, 0, cached->iterations[0],
+        cached->status[0], cached->objectiveValue[0], NULL);
+      status1 = result->updateInformation(info, this, 1, cached->iterations[1],
+        cached->status[1], cached->objectiveValue[1], NULL);
+      numberStrongDone_++;
+      numberResultsReused_++;
     } else {
-      // adding cuts or something
-      thisSolver = solver->clone();
-      branch->branch(thisSolver);
-      // set hot start iterations
-      int limit;
-      thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
-      thisSolver->setIntParam(OsiMaxNumIteration, limit);
-      thisSolver->resolve();
-    }
-    // can check if we got solution
-    // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
-    int status0 = result->updateInformation(thisSolver, info, this);
-    numberStrongIterations_ += thisSolver->getIterationCount();
-    if (status0 == 3) {
-      // new solution already saved
-      if (trustStrongForSolution_) {
-        info->cutoff_ = goodObjectiveValue_;
-        status0 = 0;
+      int solverStatus[2];
+      double objectiveValue[2];
+      int iterations[2];
+      /*
+        Try the first direction.  Each subsequent call to branch() performs the
+        specified branch and advances the branch object state to the next branch
+        alternative.)
+      */
+      OsiSolverInterface *thisSolver = solver;
+      if (branch->boundBranch()) {
+        // ordinary
+        branch->branch(solver, &journal);
+        // maybe we should check bounds for stupidities here?
+        solver->solveFromHotStart();
+      } else {
+        // adding cuts or something
+        thisSolver = solver->clone();
+        branch->branch(thisSolver);
+        // set hot start iterations
+        int limit;
+        thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
+        thisSolver->setIntParam(OsiMaxNumIteration, limit);
+        thisSolver->resolve();
       }
-    }
-    if (solver != thisSolver)
-      delete thisSolver;
-    // Restore bounds
-    for (int j = 0; j < numberColumns; j++) {
-      if (saveLower[j] != lower[j])
-        solver->setColLower(j, saveLower[j]);
-      if (saveUpper[j] != upper[j])
-        solver->setColUpper(j, saveUpper[j]);
-    }
-    /*
-      Try the next direction
-    */
-    thisSolver = solver;
-    if (branch->boundBranch()) {
-      // ordinary
-      branch->branch(solver);
-      // maybe we should check bounds for stupidities here?
-      solver->solveFromHotStart();
-    } else {
-      // adding cuts or something
-      thisSolver = solver->clone();
-      branch->branch(thisSolver);
-      // set hot start iterations
-      int limit;
-      thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
-      thisSolver->setIntParam(OsiMaxNumIteration, limit);
-      thisSolver->resolve();
-    }
-    // can check if we got solution
-    // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
-    int status1 = result->updateInformation(thisSolver, info, this);
-    numberStrongDone_++;
-    numberStrongIterations_ += thisSolver->getIterationCount();
-    if (status1 == 3) {
-      // new solution already saved
-      if (trustStrongForSolution_) {
-        info->cutoff_ = goodObjectiveValue_;
-        status1 = 0;
+      // can check if we got solution
+      // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
+      status0 = result->updateInformation(thisSolver, info, this);
+      numberStrongIterations_ += thisSolver->getIterationCount();
+      if (status0 == 3) {
+        // new solution already saved
+        if (trustStrongForSolution_) {
+          info->cutoff_ = goodObjectiveValue_;
+          status0 = 0;
+        }
       }
-    }
-    if (solver != thisSolver)
-      delete thisSolver;
-    // Restore bounds
-    for (int j = 0; j < numberColumns; j++) {
-      if (saveLower[j] != lower[j])
-        solver->setColLower(j, saveLower[j]);
-      if (saveUpper[j] != upper[j])
-        solver->setColUpper(j, saveUpper[j]);
+      if (cacheIndex >= 0) {
+        solverStatus[0] = strongBranchStatus(thisSolver);
+        objectiveValue[0] = thisSolver->getObjSense() * thisSolver->getObjValue();
+        iterations[0] = thisSolver->getIterationCount();
+      }
+      if (solver != thisSolver)
+        delete thisSolver;
+      // Restore bounds
+      if (journal.complete()) {
+        journal.restore(solver);
+      } else {
+        for (int j = 0; j < numberColumns; j++) {
+          if (saveLower[j] != lower[j])
+            solver->setColLower(j, saveLower[j]);
+          if (saveUpper[j] != upper[j])
+            solver->setColUpper(j, saveUpper[j]);
+        }
+        journal.clear();
+      }
+      /*
+        Try the next direction
+      */
+      thisSolver = solver;
+      if (branch->boundBranch()) {
+        // ordinary
+        branch->branch(solver, &journal);
+        // maybe we should check bounds for stupidities here?
+        solver->solveFromHotStart();
+      } else {
+        // adding cuts or something
+        thisSolver = solver->clone();
+        branch->branch(thisSolver);
+        // set hot start iterations
+        int limit;
+        thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
+        thisSolver->setIntParam(OsiMaxNumIteration, limit);
+        thisSolver->resolve();
+      }
+      // can check if we got solution
+      // status is 0 finished, 1 infeasible and 2 unfinished and 3 is solution
+      status1 = result->updateInformation(thisSolver, info, this);
+      numberStrongDone_++;
+      numberStrongIterations_ += thisSolver->getIterationCount();
+      if (status1 == 3) {
+        // new solution already saved
+        if (trustStrongForSolution_) {
+          info->cutoff_ = goodObjectiveValue_;
+          status1 = 0;
+        }
+      }
+      if (cacheIndex >= 0) {
+        solverStatus[1] = strongBranchStatus(thisSolver);
+        objectiveValue[1] = thisSolver->getObjSense() * thisSolver->getObjValue();
+        iterations[1] = thisSolver->getIterationCount();
+      }
+      if (solver != thisSolver)
+        delete thisSolver;
+      // Restore bounds
+      if (journal.complete()) {
+        journal.restore(solver);
+      } else {
+        for (int j = 0; j < numberColumns; j++) {
+          if (saveLower[j] != lower[j])
+            solver->setColLower(j, saveLower[j]);
+          if (saveUpper[j] != upper[j])
+            solver->setColUpper(j, saveUpper[j]);
+        }
+        journal.clear();
+      }
+      addCacheResult(cacheIndex, result, solverStatus, objectiveValue, iterations);
     }
     /*
       End of evaluation for this candidate variable. Possibilities are:
@@ -468,10 +602,14 @@ int OsiChooseStrong::doStrongBranching(OsiSolverInterface *solver,
       from the evaluation loop and assume the node will be reoptimised by the
       caller.
     */
+    if (strongStatistics_)
+      addStrongRecord(result, iDo, cached ? 2 : (branch->boundBranch() ? 0 : 1),
+        0, iterationLimit, CoinWallclockTime() - candidateStart);
     numResults_++;
     if (status0 == 1 && status1 == 1) {
       // infeasible
       returnCode = -1;
+      setStrongStop(1);
       break; // exit loop
     } else if (status0 == 1 || status1 == 1) {
       numberStrongFixed_++;
@@ -479,22 +617,362 @@ int OsiChooseStrong::doStrongBranching(OsiSolverInterface *solver,
         returnCode = 1;
       } else {
         returnCode = 2;
+        setStrongStop(2);
         break;
       }
     }
     bool hitMaxTime = (CoinCpuTime() - timeStart > info->timeRemaining_);
     if (hitMaxTime) {
       returnCode = 3;
+      setStrongStop(3);
       break;
     }
   }
-  delete[] saveLower;
-  delete[] saveUpper;
   // Delete the snapshot
   solver->unmarkHotStart();
   return returnCode;
 }
 
+namespace {
+// What a thread keeps of one branch it solved
+struct BranchOutcome {
+  int iterations;
+  // 0 optimal, 1 infeasible, 2 not finished (see OsiHotInfo)
+  int status;
+  double objectiveValue;
+  // only if feasible for all objects
+  std::vector< double > solution;
+  // wall clock seconds and thread (if statistics are kept)
+  double time;
+  int thread;
+};
+
+/* Do one branch on a pool solver in hot start (as doStrongBranching) and
+   put bounds back (from the journal if it is complete).  The solution is only checked if it could be used. */
+void solveBranch(OsiSolverInterface *poolSolver, OsiBranchingObject *branch,
+  OsiBranchingInformation &threadInfo, const OsiChooseVariable *choose,
+  const double *nodeLower, const double *nodeUpper, OsiBoundJournal &journal,
+  BranchOutcome &outcome)
+{
+  OsiSolverInterface *thisSolver = poolSolver;
+  if (branch->boundBranch()) {
+    branch->branch(poolSolver, &journal);
+    poolSolver->solveFromHotStart();
+  } else {
+    // adding cuts or something
+    thisSolver = poolSolver->clone();
+    branch->branch(thisSolver);
+    int limit;
+    thisSolver->getIntParam(OsiMaxNumIterationHotStart, limit);
+    thisSolver->setIntParam(OsiMaxNumIteration, limit);
+    thisSolver->resolve();
+  }
+  outcome.iterations = thisSolver->getIterationCount();
+  outcome.status = strongBranchStatus(thisSolver);
+  double objectiveValue = thisSolver->getObjSense() * thisSolver->getObjValue();
+  outcome.objectiveValue = objectiveValue;
+  outcome.solution.clear();
+  // cutoff and best solution can only get better before results are used
+  if (!outcome.status && choose->trustStrongForSolution()
+    && objectiveValue < choose->goodObjectiveValue()
+    && !(choose->trustStrongForBound() && objectiveValue >= threadInfo.cutoff_)) {
+    threadInfo.solver_ = thisSolver;
+    threadInfo.lower_ = thisSolver->getColLower();
+    threadInfo.upper_ = thisSolver->getColUpper();
+    const double *solution = thisSolver->getColSolution();
+    if (const_cast< OsiChooseVariable * >(choose)->feasibleSolution(&threadInfo,
+          solution, thisSolver->numberObjects(),
+          const_cast< const OsiObject ** >(thisSolver->objects())))
+      outcome.solution.assign(solution, solution + thisSolver->getNumCols());
+  }
+  if (thisSolver != poolSolver)
+    delete thisSolver;
+  // Restore bounds
+  if (journal.complete()) {
+    journal.restore(poolSolver);
+  } else {
+    int numberColumns = poolSolver->getNumCols();
+    const double *lower = poolSolver->getColLower();
+    const double *upper = poolSolver->getColUpper();
+    for (int j = 0; j < numberColumns; j++) {
+      if (nodeLower[j] != lower[j])
+        poolSolver->setColLower(j, nodeLower[j]);
+      if (nodeUpper[j] != upper[j])
+        poolSolver->setColUpper(j, nodeUpper[j]);
+    }
+    journal.clear();
+  }
+}
+
+/* Parts of the model a pool solver must share with its source, and which
+   must not change for kept strong branching results to be reused */
+const OsiSolverInterface::ModelPart poolParts[] = {
+  OsiSolverInterface::RowBoundsPart, OsiSolverInterface::ObjectivePart,
+  OsiSolverInterface::MatrixPart, OsiSolverInterface::IntegralityPart
+};
+const int numberPoolParts = static_cast< int >(sizeof(poolParts) / sizeof(poolParts[0]));
+
+/* For solvers without model versions: true if the row bounds and objective
+   of a pool solver are still those of its source */
+bool sameRowsAndObjective(const OsiSolverInterface *poolSolver,
+  const OsiSolverInterface *solver)
+{
+  int numberRows = solver->getNumRows();
+  int numberColumns = solver->getNumCols();
+  if (poolSolver->getNumRows() != numberRows || poolSolver->getNumCols() != numberColumns)
+    return false;
+  if (poolSolver->getObjSense() != solver->getObjSense())
+    return false;
+  const double *rowLower = solver->getRowLower();
+  const double *rowUpper = solver->getRowUpper();
+  const double *objective = solver->getObjCoefficients();
+  return std::equal(rowLower, rowLower + numberRows, poolSolver->getRowLower())
+    && std::equal(rowUpper, rowUpper + numberRows, poolSolver->getRowUpper())
+    && std::equal(objective, objective + numberColumns, poolSolver->getObjCoefficients());
+}
+}
+
+/* Clones are made serially as clone() may not be safe to call from several
+   threads on one solver.  They are resolved by their threads. */
+void OsiChooseStrong::refreshSolverPool(const OsiSolverInterface *solver,
+  const OsiBranchingInformation *info, int numberSolvers)
+{
+  bool trackVersions = solver->tracksModelVersions();
+  bool sameModel = poolSource_ == solver;
+  if (sameModel && trackVersions) {
+    // only column bounds are given to the clones below
+    for (int k = 0; k < numberPoolParts; k++) {
+      if (poolVersions_[k] != solver->modelVersion(poolParts[k]))
+        sameModel = false;
+    }
+  }
+  if (!sameModel)
+    clearSolverPool();
+  poolSource_ = solver;
+  poolVersions_.resize(numberPoolParts);
+  for (int k = 0; k < numberPoolParts; k++)
+    poolVersions_[k] = solver->modelVersion(poolParts[k]);
+  if (static_cast< int >(solverPool_.size()) < numberSolvers)
+    solverPool_.resize(numberSolvers, NULL);
+  int numberColumns = solver->getNumCols();
+  int numberRows = solver->getNumRows();
+  CoinWarmStart *warmStart = solver->getWarmStart();
+  double cutoff;
+  solver->getDblParam(OsiDualObjectiveLimit, cutoff);
+  int limit;
+  solver->getIntParam(OsiMaxNumIterationHotStart, limit);
+  for (int i = 0; i < numberSolvers; i++) {
+    OsiSolverInterface *poolSolver = solverPool_[i];
+    bool stale = false;
+    if (poolSolver && trackVersions)
+      stale = poolSolver->getNumCols() != numberColumns || poolSolver->getNumRows() != numberRows;
+    else if (poolSolver)
+      stale = !sameRowsAndObjective(poolSolver, solver);
+    if (stale) {
+      delete poolSolver;
+      poolSolver = NULL;
+    }
+    if (!poolSolver) {
+      poolSolver = solver->clone();
+      solverPool_[i] = poolSolver;
+    }
+    const double *lower = poolSolver->getColLower();
+    const double *upper = poolSolver->getColUpper();
+    for (int j = 0; j < numberColumns; j++) {
+      if (info->lower_[j] != lower[j])
+        poolSolver->setColLower(j, info->lower_[j]);
+      if (info->upper_[j] != upper[j])
+        poolSolver->setColUpper(j, info->upper_[j]);
+    }
+    poolSolver->setDblParam(OsiDualObjectiveLimit, cutoff);
+    poolSolver->setIntParam(OsiMaxNumIterationHotStart, limit);
+    if (warmStart)
+      poolSolver->setWarmStart(warmStart);
+  }
+  delete warmStart;
+}
+
+/*  As doStrongBranching but candidates are solved by several threads, each
+    on its own solver.  Results are then used in candidate order just as the
+    serial loop would, so returns and decisions are the same.  A thread
+    skips a candidate beyond one which stops the loop.  Time is wall clock.
+*/
+int OsiChooseStrong::doStrongBranchingParallel(OsiSolverInterface *solver,
+  OsiBranchingInformation *info,
+  int numberToDo, int returnCriterion)
+{
+  std::vector< BranchOutcome > outcomes(2 * numberToDo);
+  // 0 not done, 1 done, 2 done and out of time
+  std::vector< int > done(numberToDo, 0);
+  int lastNeeded = numberToDo - 1;
+  double cutoff = info->cutoff_;
+  // results kept from an earlier call at this node are not solved again
+  bool reuseCache;
+  int cacheIndex = cacheNode(solver, info, reuseCache);
+  int iterationLimit = 0;
+  if (strongStatistics_) {
+    solver->getIntParam(OsiMaxNumIterationHotStart, iterationLimit);
+    numberStrongCalls_++;
+  }
+  std::vector< char > fromCache(numberToDo, 0);
+  int numberToSolve = numberToDo;
+  if (reuseCache) {
+    numberToSolve = 0;
+    for (int iDo = 0; iDo <= lastNeeded; iDo++) {
+      const StrongCacheResult *cached = findCacheResult(cacheIndex, results_ + iDo);
+      if (!cached) {
+        numberToSolve++;
+        continue;
+      }
+      bool infeasible[2];
+      for (int k = 0; k < 2; k++) {
+        BranchOutcome &outcome = outcomes[2 * iDo + k];
+        outcome.iterations = cached->iterations[k];
+        outcome.status = cached->status[k];
+        outcome.objectiveValue = cached->objectiveValue[k];
+        outcome.time = 0.0;
+        outcome.thread = 0;
+        infeasible[k] = outcome.status == 1
+          || (!outcome.status && trustStrongForBound_ && outcome.objectiveValue >= cutoff);
+      }
+      fromCache[iDo] = 1;
+      done[iDo] = 1;
+      if ((infeasible[0] && infeasible[1])
+        || (returnCriterion && (infeasible[0] || infeasible[1])))
+        lastNeeded = iDo;
+    }
+  }
+  int numberThreads = CoinMin(numberThreads_, numberToSolve);
+  int numberColumns = solver->getNumCols();
+  double *nodeLower = CoinCopyOfArray(info->lower_, numberColumns);
+  double *nodeUpper = CoinCopyOfArray(info->upper_, numberColumns);
+  double timeStart = CoinWallclockTime();
+  if (numberThreads) {
+    refreshSolverPool(solver, info, numberThreads);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(numberThreads)
+#endif
+    {
+#ifdef _OPENMP
+      int iThread = omp_get_thread_num();
+#else
+      int iThread = 0;
+#endif
+      OsiSolverInterface *poolSolver = solverPool_[iThread];
+      OsiBranchingInformation threadInfo(*info);
+      OsiBoundJournal journal;
+      poolSolver->resolve();
+      poolSolver->markHotStart();
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+      for (int iDo = 0; iDo < numberToDo; iDo++) {
+        int last;
+#ifdef _OPENMP
+#pragma omp critical(OsiChooseStrongLast)
+#endif
+        last = lastNeeded;
+        if (iDo > last || fromCache[iDo])
+          continue;
+        OsiBranchingObject *branch = results_[iDo].branchingObject();
+        assert(branch->numberBranches() == 2);
+        bool infeasible[2];
+        for (int k = 0; k < 2; k++) {
+          BranchOutcome &outcome = outcomes[2 * iDo + k];
+          double branchStart = strongStatistics_ ? CoinWallclockTime() : 0.0;
+          solveBranch(poolSolver, branch, threadInfo, this, nodeLower,
+            nodeUpper, journal, outcome);
+          outcome.time = strongStatistics_ ? CoinWallclockTime() - branchStart : 0.0;
+          outcome.thread = iThread;
+          infeasible[k] = outcome.status == 1
+            || (!outcome.status && trustStrongForBound_ && outcome.objectiveValue >= cutoff);
+        }
+        // would the serial loop stop here
+        bool stop = (infeasible[0] && infeasible[1])
+          || (returnCriterion && (infeasible[0] || infeasible[1]));
+        done[iDo] = 1;
+        if (CoinWallclockTime() - timeStart > info->timeRemaining_) {
+          done[iDo] = 2;
+          stop = true;
+        }
+        if (stop) {
+#ifdef _OPENMP
+#pragma omp critical(OsiChooseStrongLast)
+#endif
+          lastNeeded = CoinMin(lastNeeded, iDo);
+        }
+      }
+      poolSolver->unmarkHotStart();
+    }
+  }
+  delete[] nodeLower;
+  delete[] nodeUpper;
+  numResults_ = 0;
+  int returnCode = 0;
+  for (int iDo = 0; iDo < numberToDo; iDo++) {
+    if (!done[iDo]) {
+      returnCode = 3;
+      break;
+    }
+    OsiHotInfo *result = results_ + iDo;
+    int status[2];
+    int solverStatus[2];
+    double objectiveValue[2];
+    int iterations[2];
+    for (int k = 0; k < 2; k++) {
+      const BranchOutcome &outcome = outcomes[2 * iDo + k];
+      status[k] = result->updateInformation(info, this, k,
+        outcome.iterations, outcome.status, outcome.objectiveValue,
+        outcome.solution.empty() ? NULL : &outcome.solution[0]);
+      solverStatus[k] = outcome.status;
+      objectiveValue[k] = outcome.objectiveValue;
+      iterations[k] = outcome.iterations;
+      if (!fromCache[iDo])
+        numberStrongIterations_ += outcome.iterations;
+      if (status[k] == 3) {
+        // new solution already saved
+        if (trustStrongForSolution_) {
+          info->cutoff_ = goodObjectiveValue_;
+          status[k] = 0;
+        }
+      }
+    }
+    if (fromCache[iDo])
+      numberResultsReused_++;
+    else
+      addCacheResult(cacheIndex, result, solverStatus, objectiveValue, iterations);
+    if (strongStatistics_) {
+      const BranchOutcome *outcome = &outcomes[2 * iDo];
+      addStrongRecord(result, iDo,
+        fromCache[iDo] ? 2 : (result->branchingObject()->boundBranch() ? 0 : 1),
+        outcome[0].thread, iterationLimit, outcome[0].time + outcome[1].time);
+    }
+    numberStrongDone_++;
+    numResults_++;
+    if (status[0] == 1 && status[1] == 1) {
+      // infeasible
+      returnCode = -1;
+      setStrongStop(1);
+      break;
+    } else if (status[0] == 1 || status[1] == 1) {
+      numberStrongFixed_++;
+      if (!returnCriterion) {
+        returnCode = 1;
+      } else {
+        returnCode = 2;
+        setStrongStop(2);
+        break;
+      }
+    }
+    if (done[iDo] == 2) {
+      returnCode = 3;
+      setStrongStop(3);
+      break;
+    }
+  }
+  return returnCode;
+}
+
 // Given a candidate fill in useful information e.g. estimates
 void OsiChooseVariable::updateInformation(const OsiBranchingInformation *info,
   int, OsiHotInfo *hotInfo)
@@ -604,14 +1082,49 @@ void OsiPseudoCosts::initialize(int n)
   }
 }
 
+OsiStrongRecord::OsiStrongRecord()
+  : call_(-1)
+  , position_(-1)
+  , whichObject_(-1)
+  , value_(0.0)
+  , method_(0)
+  , thread_(0)
+  , iterationLimit_(0)
+  , time_(0.0)
+  , stop_(0)
+{
+  for (int k = 0; k < 2; k++) {
+    status_[k] = -1;
+    change_[k] = 0.0;
+    iterations_[k] = 0;
+  }
+}
+
 //##############################################################################
 
 OsiChooseStrong::OsiChooseStrong()
   : OsiChooseVariable()
   , shadowPriceMode_(0)
   , pseudoCosts_()
+  , sharedPseudoCosts_(NULL)
+  , pseudoCostsBase_()
   , results_(NULL)
   , numResults_(0)
+  , maximumResults_(0)
+  , numberThreads_(1)
+  , solverPool_()
+  , poolSource_(NULL)
+  , poolVersions_()
+  , incrementalList_(false)
+  , lastObjects_(NULL)
+  , lastIntegerTolerance_(0.0)
+  , resultCacheSize_(0)
+  , resultCache_()
+  , resultCacheClock_(0)
+  , numberResultsReused_(0)
+  , strongStatistics_(false)
+  , strongRecords_()
+  , numberStrongCalls_(0)
 {
 }
 
@@ -619,8 +1132,25 @@ OsiChooseStrong::OsiChooseStrong(const OsiSolverInterface *solver)
   : OsiChooseVariable(solver)
   , shadowPriceMode_(0)
   , pseudoCosts_()
+  , sharedPseudoCosts_(NULL)
+  , pseudoCostsBase_()
   , results_(NULL)
   , numResults_(0)
+  , maximumResults_(0)
+  , numberThreads_(1)
+  , solverPool_()
+  , poolSource_(NULL)
+  , poolVersions_()
+  , incrementalList_(false)
+  , lastObjects_(NULL)
+  , lastIntegerTolerance_(0.0)
+  , resultCacheSize_(0)
+  , resultCache_()
+  , resultCacheClock_(0)
+  , numberResultsReused_(0)
+  , strongStatistics_(false)
+  , strongRecords_()
+  , numberStrongCalls_(0)
 {
   // create useful arrays
   pseudoCosts_.initialize(solver_->numberObjects());
@@ -630,9 +1160,29 @@ OsiChooseStrong::OsiChooseStrong(const OsiChooseStrong &rhs)
   : OsiChooseVariable(rhs)
   , shadowPriceMode_(rhs.shadowPriceMode_)
   , pseudoCosts_(rhs.pseudoCosts_)
+  , sharedPseudoCosts_(rhs.sharedPseudoCosts_)
+  , pseudoCostsBase_()
   , results_(NULL)
   , numResults_(0)
+  , maximumResults_(0)
+  , numberThreads_(rhs.numberThreads_)
+  , solverPool_()
+  , poolSource_(NULL)
+  , poolVersions_()
+  , incrementalList_(rhs.incrementalList_)
+  , lastObjects_(NULL)
+  , lastIntegerTolerance_(0.0)
+  , resultCacheSize_(rhs.resultCacheSize_)
+  , resultCache_()
+  , resultCacheClock_(0)
+  , numberResultsReused_(0)
+  , strongStatistics_(rhs.strongStatistics_)
+  , strongRecords_()
+  , numberStrongCalls_(0)
 {
+  // what rhs has not merged yet is for rhs to merge
+  if (sharedPseudoCosts_)
+    pseudoCostsBase_ = pseudoCosts_;
 }
 
 OsiChooseStrong &
@@ -642,9 +1192,23 @@ OsiChooseStrong::operator=(const OsiChooseStrong &rhs)
     OsiChooseVariable::operator=(rhs);
     shadowPriceMode_ = rhs.shadowPriceMode_;
     pseudoCosts_ = rhs.pseudoCosts_;
+    sharedPseudoCosts_ = rhs.sharedPseudoCosts_;
+    if (sharedPseudoCosts_)
+      pseudoCostsBase_ = pseudoCosts_;
+    else
+      pseudoCostsBase_ = OsiPseudoCosts();
     delete[] results_;
     results_ = NULL;
     numResults_ = 0;
+    maximumResults_ = 0;
+    numberThreads_ = rhs.numberThreads_;
+    clearSolverPool();
+    incrementalList_ = rhs.incrementalList_;
+    resetIncrementalList();
+    resultCacheSize_ = rhs.resultCacheSize_;
+    clearResultCache();
+    strongStatistics_ = rhs.strongStatistics_;
+    clearStrongRecords();
   }
   return *this;
 }
@@ -652,6 +1216,7 @@ OsiChooseStrong::operator=(const OsiChooseStrong &rhs)
 OsiChooseStrong::~OsiChooseStrong()
 {
   delete[] results_;
+  clearSolverPool();
 }
 
 // Clone
@@ -676,10 +1241,14 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
   }
   numberOnList_ = 0;
   numberUnsatisfied_ = 0;
+  if (initialize && sharedPseudoCosts_)
+    synchronizePseudoCosts();
   int numberObjects = solver_->numberObjects();
   if (numberObjects > pseudoCosts_.numberObjects()) {
     // redo useful arrays
     pseudoCosts_.initialize(numberObjects);
+    if (sharedPseudoCosts_)
+      pseudoCostsBase_ = pseudoCosts_;
   }
   double check = -COIN_DBL_MAX;
   int checkIndex = 0;
@@ -687,10 +1256,6 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
   int maximumStrong = CoinMin(numberStrong_, numberObjects);
   int putOther = numberObjects;
   int i;
-  for (i = 0; i < numberObjects; i++) {
-    list_[i] = -1;
-    useful_[i] = 0.0;
-  }
   OsiObject **object = info->solver_->objects();
   // Get average pseudo costs and see if pseudo shadow prices possible
   int shadowPossible = shadowPriceMode_;
@@ -713,9 +1278,37 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
       info->defaultDual_ = sumPi; // switch on
       int numberColumns = solver_->getNumCols();
       int size = CoinMax(numberColumns, 2 * numberRows);
-      info->usefulRegion_ = new double[size];
+      // kept in the chooser so there is no allocation from node to node
+      shadowUseful_.resize(size);
+      shadowIndex_.resize(size);
+      info->usefulRegion_ = &shadowUseful_[0];
       CoinZeroN(info->usefulRegion_, size);
-      info->indexRegion_ = new int[size];
+      info->indexRegion_ = &shadowIndex_[0];
+    }
+  }
+  /* Incremental - objects with positive infeasibility from last time are
+     brought up to date and are the only ones looked at (in order) */
+  bool incremental = incrementalList_ && !shadowPossible;
+  std::vector< int > &unsatisfied = sortedUnsatisfied_;
+  int numberToLook = numberObjects;
+  if (incremental) {
+    updateIncrementalList(info);
+    unsatisfied = unsatisfied_;
+    std::sort(unsatisfied.begin(), unsatisfied.end());
+    numberToLook = static_cast< int >(unsatisfied.size());
+    // only the strong slots and the end of list_ are used
+    for (i = 0; i < maximumStrong; i++) {
+      list_[i] = -1;
+      useful_[i] = 0.0;
+    }
+    for (i = numberObjects - numberToLook; i < numberObjects; i++)
+      list_[i] = -1;
+  } else {
+    if (incrementalList_)
+      resetIncrementalList();
+    for (i = 0; i < numberObjects; i++) {
+      list_[i] = -1;
+      useful_[i] = 0.0;
     }
   }
   double sumUp = 0.0;
@@ -735,15 +1328,28 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
   }
   double upMultiplier = (1.0 + sumUp) / (1.0 + numberUp);
   double downMultiplier = (1.0 + sumDown) / (1.0 + numberDown);
+  // simple integers in one pass - objects only asked if unsatisfied
+  int numberSimple = incremental ? 0 : simpleIntegerInfeasibilities(info);
+  const double *simpleInfeasibility = numberSimple ? &simpleIntegerInfeasibility_[0] : NULL;
   // Say feasible
   bool feasible = true;
 #if 0
   int pri[]={10,1000,10000};
   int priCount[]={0,0,0};
 #endif
-  for (i = 0; i < numberObjects; i++) {
-    int way;
-    double value = object[i]->infeasibility(info, way);
+  for (int iLook = 0; iLook < numberToLook; iLook++) {
+    double value;
+    if (incremental) {
+      i = unsatisfied[iLook];
+      value = lastInfeasibility_[i];
+    } else {
+      i = iLook;
+      value = i < numberSimple ? simpleInfeasibility[i] : 1.0;
+      if (value > 0.0) {
+        int way;
+        value = object[i]->infeasibility(info, way);
+      }
+    }
     if (value > 0.0) {
       numberUnsatisfied_++;
       if (value == COIN_DBL_MAX) {
@@ -862,16 +1468,428 @@ int OsiChooseStrong::setupList(OsiBranchingInformation *info, bool initialize)
   }
   // Get rid of any shadow prices info
   info->defaultDual_ = -1.0; // switch off
-  delete[] info->usefulRegion_;
-  delete[] info->indexRegion_;
+  if (!shadowPossible) {
+    delete[] info->usefulRegion_;
+    delete[] info->indexRegion_;
+  }
+  info->usefulRegion_ = NULL;
+  info->indexRegion_ = NULL;
   return numberUnsatisfied_;
 }
 
+void OsiChooseStrong::setSharedPseudoCosts(OsiSharedPseudoCosts *shared)
+{
+  sharedPseudoCosts_ = shared;
+  // all learned so far is new to the store
+  pseudoCostsBase_ = OsiPseudoCosts();
+}
+
+void OsiChooseStrong::synchronizePseudoCosts()
+{
+  if (!sharedPseudoCosts_)
+    return;
+  sharedPseudoCosts_->merge(pseudoCosts_, &pseudoCostsBase_);
+  sharedPseudoCosts_->snapshot(pseudoCosts_);
+  pseudoCostsBase_ = pseudoCosts_;
+}
+
+void OsiChooseStrong::setIncrementalList(bool yesNo)
+{
+  incrementalList_ = yesNo;
+  resetIncrementalList();
+}
+
+void OsiChooseStrong::resetIncrementalList()
+{
+  lastObjects_ = NULL;
+  lastSolution_.clear();
+  lastLower_.clear();
+  lastUpper_.clear();
+  lastInfeasibility_.clear();
+  columnObjectStart_.clear();
+  columnObjects_.clear();
+  otherObjects_.clear();
+  unsatisfied_.clear();
+  unsatisfiedPosition_.clear();
+}
+
+void OsiChooseStrong::evaluateObject(const OsiBranchingInformation *info,
+  int i)
+{
+  int way;
+  double value = info->solver_->object(i)->infeasibility(info, way);
+  lastInfeasibility_[i] = value;
+  int position = unsatisfiedPosition_[i];
+  if (value > 0.0) {
+    if (position < 0) {
+      unsatisfiedPosition_[i] = static_cast< int >(unsatisfied_.size());
+      unsatisfied_.push_back(i);
+    }
+  } else if (position >= 0) {
+    int iLast = unsatisfied_.back();
+    unsatisfied_[position] = iLast;
+    unsatisfiedPosition_[iLast] = position;
+    unsatisfied_.pop_back();
+    unsatisfiedPosition_[i] = -1;
+  }
+}
+
+/* Only columns whose value or bounds changed since last time are followed
+   to their objects.  On the first call, or if the objects may have changed,
+   everything is looked at and the column to object map is built. */
+void OsiChooseStrong::updateIncrementalList(const OsiBranchingInformation *info)
+{
+  const OsiSolverInterface *solver = info->solver_;
+  const OsiObject *const *object = solver->objects();
+  int numberObjects = solver->numberObjects();
+  int numberColumns = solver->getNumCols();
+  const double *solution = info->solution_;
+  const double *lower = info->lower_;
+  const double *upper = info->upper_;
+  int i;
+  if (lastObjects_ != object
+    || static_cast< int >(lastInfeasibility_.size()) != numberObjects
+    || static_cast< int >(lastSolution_.size()) != numberColumns
+    || lastIntegerTolerance_ != info->integerTolerance_) {
+    resetIncrementalList();
+    lastObjects_ = object;
+    lastIntegerTolerance_ = info->integerTolerance_;
+    columnObjectStart_.assign(numberColumns + 1, 0);
+    for (i = 0; i < numberObjects; i++) {
+      int iColumn = object[i]->columnNumber();
+      if (iColumn >= 0 && iColumn < numberColumns)
+        columnObjectStart_[iColumn + 1]++;
+      else
+        otherObjects_.push_back(i);
+    }
+    for (i = 0; i < numberColumns; i++)
+      columnObjectStart_[i + 1] += columnObjectStart_[i];
+    columnObjects_.resize(columnObjectStart_[numberColumns]);
+    std::vector< int > put(columnObjectStart_.begin(), columnObjectStart_.end() - 1);
+    for (i = 0; i < numberObjects; i++) {
+      int iColumn = object[i]->columnNumber();
+      if (iColumn >= 0 && iColumn < numberColumns)
+        columnObjects_[put[iColumn]++] = i;
+    }
+    lastSolution_.assign(solution, solution + numberColumns);
+    lastLower_.assign(lower, lower + numberColumns);
+    lastUpper_.assign(upper, upper + numberColumns);
+    lastInfeasibility_.assign(numberObjects, 0.0);
+    unsatisfiedPosition_.assign(numberObjects, -1);
+    for (i = 0; i < numberObjects; i++)
+      evaluateObject(info, i);
+    return;
+  }
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    if (solution[iColumn] != lastSolution_[iColumn]
+      || lower[iColumn] != lastLower_[iColumn]
+      || upper[iColumn] != lastUpper_[iColumn]) {
+      lastSolution_[iColumn] = solution[iColumn];
+      lastLower_[iColumn] = lower[iColumn];
+      lastUpper_[iColumn] = upper[iColumn];
+      for (int k = columnObjectStart_[iColumn]; k < columnObjectStart_[iColumn + 1]; k++)
+        evaluateObject(info, columnObjects_[k]);
+    }
+  }
+  for (i = 0; i < static_cast< int >(otherObjects_.size()); i++)
+    evaluateObject(info, otherObjects_[i]);
+}
+
+void OsiChooseStrong::setResultCacheSize(int value)
+{
+  resultCacheSize_ = CoinMax(value, 0);
+  if (static_cast< int >(resultCache_.size()) > resultCacheSize_)
+    clearResultCache();
+}
+
+void OsiChooseStrong::clearResultCache()
+{
+  resultCache_.clear();
+  resultCacheClock_ = 0;
+}
+
+namespace {
+// FNV-1a over the bytes of n doubles, continuing from hash
+unsigned int addFingerprint(unsigned int hash, int n, const double *values)
+{
+  const unsigned char *bytes = reinterpret_cast< const unsigned char * >(values);
+  size_t numberBytes = n * sizeof(double);
+  for (size_t i = 0; i < numberBytes; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+unsigned int boundFingerprint(int n, const double *lower, const double *upper)
+{
+  return addFingerprint(addFingerprint(2166136261u, n, lower), n, upper);
+}
+
+// For solvers without model versions: row bounds and objective
+unsigned int modelFingerprint(const OsiSolverInterface *solver)
+{
+  int numberRows = solver->getNumRows();
+  unsigned int hash = boundFingerprint(numberRows, solver->getRowLower(), solver->getRowUpper());
+  return addFingerprint(hash, solver->getNumCols(), solver->getObjCoefficients());
+}
+
+// True if the model behind results kept at node is still that of solver
+bool sameCacheModel(const OsiSolverInterface *solver,
+  const std::vector< unsigned int > &versions, unsigned int fingerprint)
+{
+  if (!solver->tracksModelVersions())
+    return fingerprint == modelFingerprint(solver);
+  for (int k = 0; k < numberPoolParts; k++) {
+    if (versions[k] != solver->modelVersion(poolParts[k]))
+      return false;
+  }
+  return true;
+}
+}
+
+int OsiChooseStrong::findCacheNode(const OsiSolverInterface *solver,
+  const OsiBranchingInformation *info, bool &reuse) const
+{
+  reuse = false;
+  if (!resultCacheSize_ || resultCache_.empty())
+    return -1;
+  int numberColumns = solver->getNumCols();
+  unsigned int fingerprint = boundFingerprint(numberColumns, info->lower_, info->upper_);
+  for (int iNode = 0; iNode < static_cast< int >(resultCache_.size()); iNode++) {
+    const StrongCacheNode &node = resultCache_[iNode];
+    if (node.fingerprint != fingerprint
+      || static_cast< int >(node.lower.size()) != numberColumns)
+      continue;
+    if (!std::equal(node.lower.begin(), node.lower.end(), info->lower_)
+      || !std::equal(node.upper.begin(), node.upper.end(), info->upper_))
+      continue;
+    // cuts change the number of rows or the objective
+    double objectiveValue = info->objectiveValue_;
+    reuse = node.numberRows == solver->getNumRows()
+      && fabs(node.objectiveValue - objectiveValue) <= 1.0e-9 * (1.0 + fabs(objectiveValue))
+      && sameCacheModel(solver, node.versions, node.modelFingerprint);
+    return iNode;
+  }
+  return -1;
+}
+
+int OsiChooseStrong::cacheNode(const OsiSolverInterface *solver,
+  const OsiBranchingInformation *info, bool &reuse)
+{
+  if (!resultCacheSize_) {
+    reuse = false;
+    return -1;
+  }
+  int iNode = findCacheNode(solver, info, reuse);
+  if (iNode < 0) {
+    int numberColumns = solver->getNumCols();
+    if (static_cast< int >(resultCache_.size()) < resultCacheSize_) {
+      iNode = static_cast< int >(resultCache_.size());
+      resultCache_.push_back(StrongCacheNode());
+    } else {
+      // drop the one used longest ago
+      iNode = 0;
+      for (int i = 1; i < static_cast< int >(resultCache_.size()); i++) {
+        if (resultCache_[i].lastUsed < resultCache_[iNode].lastUsed)
+          iNode = i;
+      }
+    }
+    StrongCacheNode &node = resultCache_[iNode];
+    node.fingerprint = boundFingerprint(numberColumns, info->lower_, info->upper_);
+    node.lower.assign(info->lower_, info->lower_ + numberColumns);
+    node.upper.assign(info->upper_, info->upper_ + numberColumns);
+    reuse = false;
+  }
+  StrongCacheNode &node = resultCache_[iNode];
+  if (!reuse) {
+    node.numberRows = solver->getNumRows();
+    node.objectiveValue = info->objectiveValue_;
+    node.versions.resize(numberPoolParts);
+    for (int k = 0; k < numberPoolParts; k++)
+      node.versions[k] = solver->modelVersion(poolParts[k]);
+    node.modelFingerprint = solver->tracksModelVersions() ? 0 : modelFingerprint(solver);
+    node.results.clear();
+  }
+  node.lastUsed = ++resultCacheClock_;
+  return iNode;
+}
+
+const OsiChooseStrong::StrongCacheResult *
+OsiChooseStrong::findCacheResult(int iNode, const OsiHotInfo *result) const
+{
+  if (iNode < 0)
+    return NULL;
+  const std::vector< StrongCacheResult > &results = resultCache_[iNode].results;
+  int whichObject = result->whichObject();
+  double value = result->branchingObject()->value();
+  for (size_t i = 0; i < results.size(); i++) {
+    if (results[i].whichObject == whichObject && results[i].value == value)
+      return &results[i];
+  }
+  return NULL;
+}
+
+void OsiChooseStrong::addCacheResult(int iNode, const OsiHotInfo *result,
+  const int *status, const double *objectiveValue, const int *iterations)
+{
+  if (iNode < 0)
+    return;
+  StrongCacheResult cached;
+  cached.whichObject = result->whichObject();
+  cached.value = result->branchingObject()->value();
+  for (int k = 0; k < 2; k++) {
+    cached.status[k] = status[k];
+    cached.objectiveValue[k] = objectiveValue[k];
+    cached.iterations[k] = iterations[k];
+  }
+  resultCache_[iNode].results.push_back(cached);
+}
+
+void OsiChooseStrong::orderListFromCache(const OsiSolverInterface *solver,
+  const OsiBranchingInformation *info)
+{
+  bool reuse;
+  int iNode = findCacheNode(solver, info, reuse);
+  if (iNode < 0 || resultCache_[iNode].results.empty())
+    return;
+  const StrongCacheNode &node = resultCache_[iNode];
+  int number = numberOnList_;
+  // latest change kept for each object on list (value may have moved)
+  std::vector< std::pair< double, int > > order;
+  std::vector< int > rest;
+  int i;
+  for (i = 0; i < number; i++) {
+    int iObject = list_[i];
+    int which = -1;
+    for (int j = static_cast< int >(node.results.size()) - 1; j >= 0; j--) {
+      if (node.results[j].whichObject == iObject) {
+        which = j;
+        break;
+      }
+    }
+    if (which < 0) {
+      rest.push_back(i);
+      continue;
+    }
+    const StrongCacheResult &cached = node.results[which];
+    double change[2];
+    for (int k = 0; k < 2; k++) {
+      if (cached.status[k] == 1)
+        change[k] = 1.0e100; // infeasible
+      else
+        change[k] = CoinMax(0.0, cached.objectiveValue[k] - node.objectiveValue);
+    }
+    double value = MAXMIN_CRITERION * CoinMin(change[0], change[1]) + (1.0 - MAXMIN_CRITERION) * CoinMax(change[0], change[1]);
+    order.push_back(std::make_pair(-value, i));
+  }
+  if (order.empty())
+    return;
+  std::sort(order.begin(), order.end());
+  std::vector< int > oldList(list_, list_ + number);
+  std::vector< double > oldUseful(useful_, useful_ + number);
+  int n = 0;
+  for (i = 0; i < static_cast< int >(order.size()); i++) {
+    list_[n] = oldList[order[i].second];
+    useful_[n++] = oldUseful[order[i].second];
+  }
+  for (i = 0; i < static_cast< int >(rest.size()); i++) {
+    list_[n] = oldList[rest[i]];
+    useful_[n++] = oldUseful[rest[i]];
+  }
+}
+
+void OsiChooseStrong::clearStrongRecords()
+{
+  strongRecords_.clear();
+  numberStrongCalls_ = 0;
+}
+
+void OsiChooseStrong::addStrongRecord(const OsiHotInfo *result, int position,
+  int method, int thread, int iterationLimit, double time)
+{
+  OsiStrongRecord record;
+  record.call_ = numberStrongCalls_ - 1;
+  record.position_ = position;
+  record.whichObject_ = result->whichObject();
+  record.value_ = result->branchingObject()->value();
+  record.method_ = method;
+  record.thread_ = thread;
+  for (int k = 0; k < 2; k++) {
+    record.status_[k] = result->status(k);
+    record.change_[k] = result->change(k);
+    record.iterations_[k] = result->iterationCount(k);
+  }
+  record.iterationLimit_ = iterationLimit;
+  record.time_ = time;
+  strongRecords_.push_back(record);
+}
+
+int OsiChooseStrong::writeStrongRecordsCsv(FILE *fp) const
+{
+  fprintf(fp, "call,position,object,value,method,thread,"
+              "down_status,up_status,down_change,up_change,"
+              "down_iterations,up_iterations,iteration_limit,time,stop\n");
+  for (size_t i = 0; i < strongRecords_.size(); i++) {
+    const OsiStrongRecord &r = strongRecords_[i];
+    fprintf(fp, "%d,%d,%d,%.15g,%d,%d,%d,%d,%.15g,%.15g,%d,%d,%d,%.6g,%d\n",
+      r.call_, r.position_, r.whichObject_, r.value_, r.method_, r.thread_,
+      r.status_[0], r.status_[1], r.change_[0], r.change_[1],
+      r.iterations_[0], r.iterations_[1], r.iterationLimit_, r.time_, r.stop_);
+  }
+  return ferror(fp) ? 1 : 0;
+}
+
+int OsiChooseStrong::writeStrongRecordsJson(FILE *fp) const
+{
+  fprintf(fp, "[");
+  for (size_t i = 0; i < strongRecords_.size(); i++) {
+    const OsiStrongRecord &r = strongRecords_[i];
+    fprintf(fp, "%s\n  {\"call\": %d, \"position\": %d, \"object\": %d, \"value\": %.15g, "
+                "\"method\": %d, \"thread\": %d, ",
+      i ? "," : "", r.call_, r.position_, r.whichObject_, r.value_, r.method_, r.thread_);
+    fprintf(fp, "\"down_status\": %d, \"up_status\": %d, \"down_change\": %.15g, \"up_change\": %.15g, ",
+      r.status_[0], r.status_[1], r.change_[0], r.change_[1]);
+    fprintf(fp, "\"down_iterations\": %d, \"up_iterations\": %d, \"iteration_limit\": %d, "
+                "\"time\": %.6g, \"stop\": %d}",
+      r.iterations_[0], r.iterations_[1], r.iterationLimit_, r.time_, r.stop_);
+  }
+  fprintf(fp, "%s]\n", strongRecords_.empty() ? "" : "\n");
+  return ferror(fp) ? 1 : 0;
+}
+
+void OsiChooseStrong::setNumberThreads(int value)
+{
+#ifdef _OPENMP
+  numberThreads_ = CoinMax(value, 1);
+#else
+  // built without OpenMP, so strong branching is always serial
+  numberThreads_ = 1;
+#endif
+  if (static_cast< int >(solverPool_.size()) > numberThreads_) {
+    for (size_t i = numberThreads_; i < solverPool_.size(); i++)
+      delete solverPool_[i];
+    solverPool_.resize(numberThreads_);
+  }
+}
+
+void OsiChooseStrong::clearSolverPool()
+{
+  for (size_t i = 0; i < solverPool_.size(); i++)
+    delete solverPool_[i];
+  solverPool_.clear();
+  poolSource_ = NULL;
+}
+
 void OsiChooseStrong::resetResults(int num)
 {
-  delete[] results_;
   numResults_ = 0;
-  results_ = new OsiHotInfo[num];
+  // keep old ones so their branching objects and arrays can be reused
+  if (num > maximumResults_) {
+    delete[] results_;
+    results_ = new OsiHotInfo[num];
+    maximumResults_ = num;
+  }
 }
 
 /* Choose a variable
@@ -900,6 +1918,9 @@ int OsiChooseStrong::chooseVariable(OsiSolverInterface *solver, OsiBranchingInfo
       pseudoCosts_.setNumberBeforeTrusted(numberBeforeTrusted);
     }
 
+    // candidates strong branched before at this node go first
+    if (resultCacheSize_)
+      orderListFromCache(solver, info);
     int numberLeft = CoinMin(numberStrong_ - numberStrongDone_, numberUnsatisfied_);
     int numberToDo = 0;
     resetResults(numberLeft);
@@ -912,7 +1933,7 @@ int OsiChooseStrong::chooseVariable(OsiSolverInterface *solver, OsiBranchingInfo
     for (int i = 0; i < numberLeft; i++) {
       int iObject = list_[i];
       if (upNumber[iObject] < numberBeforeTrusted || downNumber[iObject] < numberBeforeTrusted) {
-        results_[numberToDo++] = OsiHotInfo(solver, info,
+        results_[numberToDo++].initialize(solver, info,
           solver->objects(), iObject);
       } else {
         const OsiObject *obj = solver->object(iObject);
@@ -1080,6 +2101,180 @@ void OsiPseudoCosts::updateInformation(int index, int branch,
 }
 #endif
 
+//##############################################################################
+
+OsiChooseStrongPivot::OsiChooseStrongPivot()
+  : OsiChooseStrong()
+  , numberScreen_(100)
+  , numberPivotEstimates_(0)
+{
+}
+
+OsiChooseStrongPivot::OsiChooseStrongPivot(const OsiSolverInterface *solver)
+  : OsiChooseStrong(solver)
+  , numberScreen_(100)
+  , numberPivotEstimates_(0)
+{
+}
+
+OsiChooseStrongPivot::OsiChooseStrongPivot(const OsiChooseStrongPivot &rhs)
+  : OsiChooseStrong(rhs)
+  , numberScreen_(rhs.numberScreen_)
+  , numberPivotEstimates_(rhs.numberPivotEstimates_)
+{
+}
+
+OsiChooseStrongPivot &
+OsiChooseStrongPivot::operator=(const OsiChooseStrongPivot &rhs)
+{
+  if (this != &rhs) {
+    OsiChooseStrong::operator=(rhs);
+    numberScreen_ = rhs.numberScreen_;
+    numberPivotEstimates_ = rhs.numberPivotEstimates_;
+  }
+  return *this;
+}
+
+OsiChooseStrongPivot::~OsiChooseStrongPivot()
+{
+}
+
+// Clone
+OsiChooseVariable *
+OsiChooseStrongPivot::clone() const
+{
+  return new OsiChooseStrongPivot(*this);
+}
+
+// Initialize
+int OsiChooseStrongPivot::setupList(OsiBranchingInformation *info, bool initialize)
+{
+  const OsiSolverInterface *solver = info->solver_;
+  if (numberScreen_ <= numberStrong_ || !numberStrong_
+    || solver->canDoSimplexInterface() < 1 || !solver->basisIsAvailable())
+    return OsiChooseStrong::setupList(info, initialize);
+  // Longer list by pseudo costs
+  int saveStrong = numberStrong_;
+  numberStrong_ = numberScreen_;
+  int numberUnsatisfied = OsiChooseStrong::setupList(info, initialize);
+  numberStrong_ = saveStrong;
+  int number = numberOnList_;
+  if (number <= numberStrong_)
+    return numberUnsatisfied;
+  std::vector< double > downEstimate(number);
+  std::vector< double > upEstimate(number);
+  if (!pivotEstimates(info, number, list_, &downEstimate[0], &upEstimate[0])) {
+    // sort on estimate, keeping pseudo cost order for ties
+    std::vector< std::pair< double, int > > order(number);
+    int i;
+    for (i = 0; i < number; i++) {
+      double down = downEstimate[i];
+      double up = upEstimate[i];
+      double value;
+      if (down < 0.0 || up < 0.0 || down == COIN_DBL_MAX || up == COIN_DBL_MAX)
+        value = COIN_DBL_MAX; // infeasible branch or no estimate
+      else
+        value = MAXMIN_CRITERION * CoinMin(up, down) + (1.0 - MAXMIN_CRITERION) * CoinMax(up, down);
+      order[i] = std::make_pair(-value, i);
+    }
+    std::sort(order.begin(), order.end());
+    std::vector< int > oldList(list_, list_ + number);
+    for (i = 0; i < number; i++) {
+      list_[i] = oldList[order[i].second];
+      useful_[i] = order[i].first;
+    }
+  }
+  // rest stay on list_ after the strong ones
+  numberOnList_ = numberStrong_;
+  return numberUnsatisfied;
+}
+
+/* Estimate of each branch from the tableau row of the basic column.
+   Basic x = beta - sum alpha[k] * x[k] over nonbasic k, so moving x down
+   needs a k with alpha[k] > 0 which can increase or alpha[k] < 0 which
+   can decrease (and the other way round for up).  Moving x by one unit
+   through k costs |dj[k] / alpha[k]|, the smallest of these is the dual
+   ratio test.  Logicals have +1 coefficients so their dj is the row
+   price up to sign, and only magnitudes are used.
+*/
+int OsiChooseStrongPivot::pivotEstimates(const OsiBranchingInformation *info,
+  int number, const int *which, double *downEstimate, double *upEstimate)
+{
+  const OsiSolverInterface *solver = info->solver_;
+  int numberColumns = solver->getNumCols();
+  int numberRows = solver->getNumRows();
+  if (solver->canDoSimplexInterface() < 1 || !solver->basisIsAvailable()
+    || !numberRows || !numberColumns)
+    return -1;
+  const double *lower = info->lower_;
+  const double *upper = info->upper_;
+  const double *rowLower = solver->getRowLower();
+  const double *rowUpper = solver->getRowUpper();
+  const double *reducedCost = solver->getReducedCost();
+  const double *rowPrice = solver->getRowPrice();
+  OsiObject **object = solver->objects();
+  solver->enableFactorization();
+  std::vector< int > basic(numberRows);
+  solver->getBasics(&basic[0]);
+  std::vector< int > rowOfColumn(numberColumns, -1);
+  int iRow;
+  for (iRow = 0; iRow < numberRows; iRow++) {
+    if (basic[iRow] < numberColumns)
+      rowOfColumn[basic[iRow]] = iRow;
+  }
+  std::vector< int > columnStatus(numberColumns);
+  std::vector< int > rowStatus(numberRows);
+  solver->getBasisStatus(&columnStatus[0], &rowStatus[0]);
+  std::vector< double > tableauRow(numberColumns);
+  std::vector< double > inverseRow(numberRows);
+  for (int i = 0; i < number; i++) {
+    downEstimate[i] = -1.0;
+    upEstimate[i] = -1.0;
+    int iColumn = object[which[i]]->columnNumber();
+    iRow = iColumn >= 0 ? rowOfColumn[iColumn] : -1;
+    if (iRow < 0)
+      continue;
+    double value = info->solution_[iColumn];
+    double downMovement = value - floor(value);
+    double upMovement = ceil(value) - value;
+    solver->getBInvARow(iRow, &tableauRow[0], &inverseRow[0]);
+    double downRatio = COIN_DBL_MAX;
+    double upRatio = COIN_DBL_MAX;
+    for (int k = 0; k < numberColumns + numberRows; k++) {
+      int status;
+      double alpha;
+      double dj;
+      bool fixed;
+      if (k < numberColumns) {
+        status = columnStatus[k];
+        alpha = tableauRow[k];
+        dj = reducedCost[k];
+        fixed = lower[k] == upper[k];
+      } else {
+        int kRow = k - numberColumns;
+        status = rowStatus[kRow];
+        alpha = inverseRow[kRow];
+        dj = rowPrice[kRow];
+        fixed = rowLower[kRow] == rowUpper[kRow];
+      }
+      if (status == 1 || fixed || fabs(alpha) < 1.0e-9)
+        continue;
+      double ratio = fabs(dj / alpha);
+      bool canIncrease = status != 2;
+      bool canDecrease = status != 3;
+      if ((alpha > 0.0 && canIncrease) || (alpha < 0.0 && canDecrease))
+        downRatio = CoinMin(downRatio, ratio);
+      if ((alpha < 0.0 && canIncrease) || (alpha > 0.0 && canDecrease))
+        upRatio = CoinMin(upRatio, ratio);
+    }
+    downEstimate[i] = downRatio < COIN_DBL_MAX ? downMovement * downRatio : COIN_DBL_MAX;
+    upEstimate[i] = upRatio < COIN_DBL_MAX ? upMovement * upRatio : COIN_DBL_MAX;
+    numberPivotEstimates_++;
+  }
+  solver->disableFactorization();
+  return 0;
+}
+
 OsiHotInfo::OsiHotInfo()
   : originalObjectiveValue_(COIN_DBL_MAX)
   , changes_(NULL)
@@ -1087,6 +2282,7 @@ OsiHotInfo::OsiHotInfo()
   , statuses_(NULL)
   , branchingObject_(NULL)
   , whichObject_(-1)
+  , maximumBranches_(0)
 {
 }
 
@@ -1095,17 +2291,37 @@ OsiHotInfo::OsiHotInfo(OsiSolverInterface *solver,
   const OsiObject *const *objects,
   int whichObject)
   : originalObjectiveValue_(COIN_DBL_MAX)
+  , changes_(NULL)
+  , iterationCounts_(NULL)
+  , statuses_(NULL)
+  , branchingObject_(NULL)
   , whichObject_(whichObject)
+  , maximumBranches_(0)
+{
+  initialize(solver, info, objects, whichObject);
+}
+
+void OsiHotInfo::initialize(OsiSolverInterface *solver,
+  const OsiBranchingInformation *info,
+  const OsiObject *const *objects,
+  int whichObject)
 {
   originalObjectiveValue_ = info->objectiveValue_;
+  whichObject_ = whichObject;
   const OsiObject *object = objects[whichObject_];
   // create object - "down" first
-  branchingObject_ = object->createBranch(solver, info, 0);
-  // create arrays
+  branchingObject_ = object->recreateBranch(branchingObject_, solver, info, 0);
+  // create arrays if not big enough
   int numberBranches = branchingObject_->numberBranches();
-  changes_ = new double[numberBranches];
-  iterationCounts_ = new int[numberBranches];
-  statuses_ = new int[numberBranches];
+  if (numberBranches > maximumBranches_) {
+    delete[] changes_;
+    delete[] iterationCounts_;
+    delete[] statuses_;
+    changes_ = new double[numberBranches];
+    iterationCounts_ = new int[numberBranches];
+    statuses_ = new int[numberBranches];
+    maximumBranches_ = numberBranches;
+  }
   CoinZeroN(changes_, numberBranches);
   CoinZeroN(iterationCounts_, numberBranches);
   CoinFillN(statuses_, numberBranches, -1);
@@ -1121,11 +2337,13 @@ OsiHotInfo::OsiHotInfo(const OsiHotInfo &rhs)
     changes_ = CoinCopyOfArray(rhs.changes_, numberBranches);
     iterationCounts_ = CoinCopyOfArray(rhs.iterationCounts_, numberBranches);
     statuses_ = CoinCopyOfArray(rhs.statuses_, numberBranches);
+    maximumBranches_ = numberBranches;
   } else {
     branchingObject_ = NULL;
     changes_ = NULL;
     iterationCounts_ = NULL;
     statuses_ = NULL;
+    maximumBranches_ = 0;
   }
 }
 
@@ -1145,11 +2363,13 @@ OsiHotInfo::operator=(const OsiHotInfo &rhs)
       changes_ = CoinCopyOfArray(rhs.changes_, numberBranches);
       iterationCounts_ = CoinCopyOfArray(rhs.iterationCounts_, numberBranches);
       statuses_ = CoinCopyOfArray(rhs.statuses_, numberBranches);
+      maximumBranches_ = numberBranches;
     } else {
       branchingObject_ = NULL;
       changes_ = NULL;
       iterationCounts_ = NULL;
       statuses_ = NULL;
+      maximumBranches_ = 0;
     }
   }
   return *this;
@@ -1225,6 +2445,31 @@ int OsiHotInfo::updateInformation(const OsiSolverInterface *solver, const OsiBra
   choose->updateInformation(info, iBranch, this);
   return status;
 }
+/* Fill in useful information after strong branch solved elsewhere.
+   Same as above except that the solution was checked by whoever solved it.
+ */
+int OsiHotInfo::updateInformation(const OsiBranchingInformation *info,
+  OsiChooseVariable *choose, int iBranch, int iterations,
+  int solverStatus, double objectiveValue, const double *solution)
+{
+  assert(iBranch >= 0 && iBranch < branchingObject_->numberBranches());
+  iterationCounts_[iBranch] += iterations;
+  int status = solverStatus;
+  changes_[iBranch] = CoinMax(0.0, objectiveValue - originalObjectiveValue_);
+  if (choose->trustStrongForBound()) {
+    if (!status && objectiveValue >= info->cutoff_) {
+      status = 1; // infeasible
+      changes_[iBranch] = 1.0e100;
+    }
+  }
+  statuses_[iBranch] = status;
+  if (!status && solution && choose->trustStrongForSolution() && objectiveValue < choose->goodObjectiveValue()) {
+    choose->saveSolution(solution, info->solver_->getNumCols(), objectiveValue);
+    status = 3;
+  }
+  choose->updateInformation(info, iBranch, this);
+  return status;
+}
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
@@ -5,6 +5,7 @@
 #ifndef OsiChooseVariable_H
 #define OsiChooseVariable_H
 
+#include <cstdio>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,7 @@
 
 class OsiSolverInterface;
 class OsiHotInfo;
+class OsiSharedPseudoCosts;
 
 /** This class chooses a variable to branch on
 
@@ -78,6 +80,9 @@ public:
     const OsiObject **objects);
   /// Saves a good solution
   void saveSolution(const OsiSolverInterface *solver);
+  /// Saves a good solution given its values and objective (minimization sense)
+  void saveSolution(const double *solution, int numberColumns,
+    double objectiveValue);
   /// Clears out good solution after use
   void clearGoodSolution();
   /// Given a candidate fill in useful information e.g. estimates
@@ -232,6 +237,18 @@ public:
   }
 
 protected:
+  /** Infeasibilities of the objects which are simple integers.
+
+      Finds the leading objects which are exactly OsiSimpleInteger (found
+      again only when the solver's object array or number of objects
+      changes) and puts their infeasibilities in
+      simpleIntegerInfeasibility_ with OsiSimpleInteger::infeasibilities().
+      Returns how many objects that covers, 0 if shadow prices are in use.
+      The objects themselves are not called, so infeasibility() must still
+      be called for any which are unsatisfied before using their estimates.
+  */
+  int simpleIntegerInfeasibilities(const OsiBranchingInformation *info);
+
   // Data
   /// Objective value for feasible solution
   double goodObjectiveValue_;
@@ -281,6 +298,14 @@ protected:
   bool trustStrongForBound_;
   /// Trust results from strong branching for valid solution
   bool trustStrongForSolution_;
+  /// Object array simpleIntegerColumns_ was found for
+  const OsiObject *const *simpleIntegerObjects_;
+  /// Number of objects simpleIntegerColumns_ was found for
+  int simpleIntegerNumberObjects_;
+  /// Columns of the leading objects which are simple integers
+  std::vector< int > simpleIntegerColumns_;
+  /// Infeasibilities of those objects
+  std::vector< double > simpleIntegerInfeasibility_;
 };
 
 /** This class is the placeholder for the pseudocosts used by OsiChooseStrong.
@@ -358,6 +383,59 @@ public:
 #endif
 };
 
+/** What strong branching did on one candidate
+
+    Kept by OsiChooseStrong when strong branching statistics are on (see
+    OsiChooseStrong::setStrongStatistics()).  Index 0 of the arrays is the
+    down branch and 1 the up branch.
+*/
+class OSILIB_EXPORT OsiStrongRecord {
+
+public:
+  /// Default Constructor
+  OsiStrongRecord();
+
+  // Note public
+public:
+  /// Call of strong branching (counted from 0 when records are cleared)
+  int call_;
+  /// Position of candidate in that call
+  int position_;
+  /// Object
+  int whichObject_;
+  /// Value of branching object
+  double value_;
+  /** How the branches were done
+      0 - bounds changed and solveFromHotStart
+      1 - on a clone of the solver (not OsiBranchingObject::boundBranch())
+      2 - results kept from an earlier call (see OsiChooseStrong::setResultCacheSize())
+  */
+  int method_;
+  /// Thread which did it (0 if serial)
+  int thread_;
+  /** Status as OsiHotInfo
+      0 - feasible and finished
+      1 - infeasible (or above cutoff)
+      2 - not finished (hot start iteration limit)
+  */
+  int status_[2];
+  /// Objective change
+  double change_[2];
+  /// Iterations
+  int iterations_[2];
+  /// Hot start iteration limit (OsiMaxNumIterationHotStart)
+  int iterationLimit_;
+  /// Wall clock seconds for both branches
+  double time_;
+  /** Why strong branching stopped after this candidate
+      0 - it did not
+      1 - infeasible both ways
+      2 - infeasible one way, returning early
+      3 - time limit
+  */
+  int stop_;
+};
+
 /** This class chooses a variable to branch on
 
     This chooses the variable and direction with reliability strong branching.
@@ -456,7 +534,193 @@ public:
     return pseudoCosts_.numberObjects();
   }
 
+  /** Share pseudo costs with other choosers (NULL to stop)
+
+      The store is not owned.  pseudoCosts() stays the one the chooser
+      reads and may still be updated as before.  At each setupList with
+      initialize true, what it learned since the last time is merged into
+      the store and it is refreshed from the store (see
+      synchronizePseudoCosts()).  So workers in other threads, each with
+      its own chooser, learn from each other from node to node.
+      The store should be initialized with the number of objects.
+  */
+  void setSharedPseudoCosts(OsiSharedPseudoCosts *shared);
+  /// Shared pseudo costs (NULL if none)
+  inline OsiSharedPseudoCosts *sharedPseudoCosts() const
+  {
+    return sharedPseudoCosts_;
+  }
+  /// Merge into the shared pseudo costs and copy them back now
+  void synchronizePseudoCosts();
+
+  /** Number of threads used for strong branching (default 1)
+
+      With more than one (and OpenMP) candidates are shared out between
+      threads, each with its own clone of the solver.  The clones are made
+      on first use and kept; at each call they are given the bounds, warm
+      start, cutoff and hot start iteration limit of the solver.  They are
+      made again if the solver passed in changes, or if its row bounds,
+      objective, matrix or integrality change (seen from the model
+      versions).  For a solver which does not tracksModelVersions() only
+      the size, row bounds and objective are compared, so call
+      clearSolverPool() after changing coefficients.
+
+      Results are taken in candidate order, exactly as if strong branching
+      had been done serially, so the same decisions are made.  Candidates
+      after one which would have stopped the serial loop may be solved
+      but are ignored.  feasibleSolution() and OsiObject::checkInfeasibility()
+      are called from the threads.
+
+      Threads need Osi to be built with OpenMP (configure does this when
+      the compiler supports it).  Otherwise setNumberThreads() always sets
+      one thread.
+  */
+  inline int numberThreads() const
+  {
+    return numberThreads_;
+  }
+  /// Set number of threads used for strong branching
+  void setNumberThreads(int value);
+  /// Delete solver clones kept for parallel strong branching
+  void clearSolverPool();
+
+  /** Incremental setupList() (default off)
+
+      When on, the infeasibility of each object is kept between calls and
+      only objects whose column has changed value or bounds are looked at
+      again, together with objects not tied to one column
+      (OsiObject::columnNumber() negative).  An object with a column must
+      depend only on the value and bounds of that column, and objects
+      must not be evaluated elsewhere between calls (other than by
+      OsiObject::checkInfeasibility()) as their estimates are used.
+      Everything is looked at if the objects, number of columns or integer
+      tolerance change, and always when pseudo shadow prices are used.
+      The list is the same as without.
+  */
+  inline bool incrementalList() const
+  {
+    return incrementalList_;
+  }
+  /// Set incremental setupList()
+  void setIncrementalList(bool yesNo);
+  /// Forget what was kept for incremental setupList() (all looked at next time)
+  void resetIncrementalList();
+
+  /** Number of nodes whose strong branching results are kept (default 0, off)
+
+      A node is known by its column bounds (a fingerprint of
+      info->lower_ and info->upper_, then an exact comparison).  For each
+      node the outcome of both branches of every candidate strong branched
+      is kept by object index and branching value.  When strong branching
+      is done again at the same node, a candidate with the same object
+      and value is not solved again: the kept outcome is given to
+      OsiHotInfo as if it had just been solved (it is checked against the
+      current cutoff, and pseudo costs are updated as for a new solve).
+
+      Results are only reused if the solver has the same number of rows,
+      the same objective value and the same row bounds, objective and
+      matrix as when they were kept, so adding or removing cuts makes
+      them stale.  If the solver tracksModelVersions() its model versions
+      are compared; otherwise a fingerprint of the row bounds and
+      objective is, and a change to the matrix alone is not seen.  Stale
+      results still put candidates in order: in chooseVariable()
+      candidates with a kept outcome go to the front of the list, those
+      with the largest change first.  They are then replaced by new
+      solves.  Call clearResultCache() when changing the matrix of a
+      solver without model versions, or when strong branching with
+      another solver.  When more nodes are seen than are kept, the one
+      used longest ago is dropped.
+  */
+  inline int resultCacheSize() const
+  {
+    return resultCacheSize_;
+  }
+  /// Set number of nodes whose strong branching results are kept
+  void setResultCacheSize(int value);
+  /// Forget all kept strong branching results
+  void clearResultCache();
+  /// Number of candidates whose kept results were reused
+  inline int numberResultsReused() const
+  {
+    return numberResultsReused_;
+  }
+
+  /** Strong branching statistics (default off)
+
+      When on, an OsiStrongRecord is kept for every candidate strong
+      branched, in order, until clearStrongRecords().  Wall clock time is
+      taken around each candidate, so this costs a little.
+  */
+  inline bool strongStatistics() const
+  {
+    return strongStatistics_;
+  }
+  /// Set strong branching statistics
+  inline void setStrongStatistics(bool yesNo)
+  {
+    strongStatistics_ = yesNo;
+  }
+  /// Number of strong branching records
+  inline int numberStrongRecords() const
+  {
+    return static_cast< int >(strongRecords_.size());
+  }
+  /// Get i'th strong branching record
+  inline const OsiStrongRecord &strongRecord(int i) const
+  {
+    return strongRecords_[i];
+  }
+  /// Number of calls of strong branching since records were cleared
+  inline int numberStrongCalls() const
+  {
+    return numberStrongCalls_;
+  }
+  /// Forget strong branching records
+  void clearStrongRecords();
+  /** Write strong branching records as CSV (a header line then one line
+      per record).  Returns 0 on success. */
+  int writeStrongRecordsCsv(FILE *fp) const;
+  /** Write strong branching records as a JSON array of objects (keys as
+      the CSV header).  Returns 0 on success. */
+  int writeStrongRecordsJson(FILE *fp) const;
+
 protected:
+  /// Kept outcome of strong branching on one candidate
+  struct StrongCacheResult {
+    /// Object
+    int whichObject;
+    /// Value of branching object
+    double value;
+    /// Solver status of each branch (0 optimal, 1 infeasible, 2 not finished)
+    int status[2];
+    /// Objective value (minimization) of each branch
+    double objectiveValue[2];
+    /// Iterations of each branch
+    int iterations[2];
+  };
+  /// Kept strong branching results of one node
+  struct StrongCacheNode {
+    /// Fingerprint of column bounds
+    unsigned int fingerprint;
+    /// Column lower bounds
+    std::vector< double > lower;
+    /// Column upper bounds
+    std::vector< double > upper;
+    /// Number of rows when results were kept
+    int numberRows;
+    /// Model versions of the solver when results were kept
+    std::vector< unsigned int > versions;
+    /// Fingerprint of row bounds and objective (solvers without versions)
+    unsigned int modelFingerprint;
+    /// Objective value (minimization) at node when results were kept
+    double objectiveValue;
+    /// When last used (larger is more recent)
+    int lastUsed;
+    /// Results by candidate
+    std::vector< StrongCacheResult > results;
+  };
+
+
   /**  This is a utility function which does strong branching on
        a list of objects and stores the results in OsiHotInfo.objects.
        On entry the object sequence is stored in the OsiHotInfo object
@@ -473,9 +737,50 @@ protected:
     OsiBranchingInformation *info,
     int numberToDo, int returnCriterion);
 
-  /** Clear out the results array */
+  /** Clear out the results array, making room for num (kept if big enough) */
   void resetResults(int num);
 
+  /** doStrongBranching() using clones in solverPool_ (same return codes) */
+  int doStrongBranchingParallel(OsiSolverInterface *solver,
+    OsiBranchingInformation *info,
+    int numberToDo, int returnCriterion);
+  /** Make sure there are numberSolvers clones of solver in solverPool_
+      with the node bounds and basis, hot start ready */
+  void refreshSolverPool(const OsiSolverInterface *solver,
+    const OsiBranchingInformation *info, int numberSolvers);
+  /** Bring lastInfeasibility_ and unsatisfied_ up to date for
+      incremental setupList() */
+  void updateIncrementalList(const OsiBranchingInformation *info);
+  /// Look at object i again (incremental setupList())
+  void evaluateObject(const OsiBranchingInformation *info, int i);
+  /** Kept results for node in info, or -1.  \p reuse is set true if the
+      results are not stale. */
+  int findCacheNode(const OsiSolverInterface *solver,
+    const OsiBranchingInformation *info, bool &reuse) const;
+  /** Kept results for node in info, made (or emptied if stale) if need be.
+      \p reuse is set true if the results may be reused. */
+  int cacheNode(const OsiSolverInterface *solver,
+    const OsiBranchingInformation *info, bool &reuse);
+  /// Kept result of a candidate at node \p iNode, or NULL
+  const StrongCacheResult *findCacheResult(int iNode,
+    const OsiHotInfo *result) const;
+  /// Keep result of a candidate at node \p iNode
+  void addCacheResult(int iNode, const OsiHotInfo *result,
+    const int *status, const double *objectiveValue, const int *iterations);
+  /** Put candidates with kept results at the front of list_ (in order of
+      their kept change) */
+  void orderListFromCache(const OsiSolverInterface *solver,
+    const OsiBranchingInformation *info);
+  /// Keep an OsiStrongRecord for a candidate just done
+  void addStrongRecord(const OsiHotInfo *result, int position, int method,
+    int thread, int iterationLimit, double time);
+  /// Say why strong branching stopped after the last record
+  inline void setStrongStop(int reason)
+  {
+    if (strongStatistics_)
+      strongRecords_.back().stop_ = reason;
+  }
+
 protected:
   /** Pseudo Shadow Price mode
       0 - off
@@ -486,12 +791,155 @@ protected:
 
   /** The pseudo costs for the chooser */
   OsiPseudoCosts pseudoCosts_;
+  /// Shared pseudo costs (not owned)
+  OsiSharedPseudoCosts *sharedPseudoCosts_;
+  /// Pseudo costs as last copied from sharedPseudoCosts_
+  OsiPseudoCosts pseudoCostsBase_;
 
   /** The results of the strong branching done on the candidates where the
       pseudocosts were not sufficient */
   OsiHotInfo *results_;
   /** The number of OsiHotInfo objetcs that contain information */
   int numResults_;
+  /// Number of OsiHotInfo objects results_ has room for
+  int maximumResults_;
+  /// Work array for shadow prices (info->usefulRegion_ during setupList)
+  std::vector< double > shadowUseful_;
+  /// Work array for shadow prices (info->indexRegion_ during setupList)
+  std::vector< int > shadowIndex_;
+  /// Column lower bounds at node saved by doStrongBranching
+  std::vector< double > saveLower_;
+  /// Column upper bounds at node saved by doStrongBranching
+  std::vector< double > saveUpper_;
+  /// Bounds changed by a strong branch in doStrongBranching
+  OsiBoundJournal journal_;
+  /// Number of threads for strong branching
+  int numberThreads_;
+  /// Solver clones for parallel strong branching
+  std::vector< OsiSolverInterface * > solverPool_;
+  /// Solver the clones in solverPool_ were made from
+  const OsiSolverInterface *poolSource_;
+  /// Model versions of poolSource_ the clones match (other than bounds)
+  std::vector< unsigned int > poolVersions_;
+  /// True if setupList() is incremental
+  bool incrementalList_;
+  /// Objects the incremental data is for (NULL if none)
+  const OsiObject *const *lastObjects_;
+  /// Integer tolerance the incremental data is for
+  double lastIntegerTolerance_;
+  /// Solution at last setupList()
+  std::vector< double > lastSolution_;
+  /// Column lower bounds at last setupList()
+  std::vector< double > lastLower_;
+  /// Column upper bounds at last setupList()
+  std::vector< double > lastUpper_;
+  /// Infeasibility of each object at last setupList()
+  std::vector< double > lastInfeasibility_;
+  /// Start of objects for each column in columnObjects_
+  std::vector< int > columnObjectStart_;
+  /// Objects by column
+  std::vector< int > columnObjects_;
+  /// Objects not tied to one column
+  std::vector< int > otherObjects_;
+  /// Objects with positive infeasibility (not in order)
+  std::vector< int > unsatisfied_;
+  /// Position of each object in unsatisfied_ or -1
+  std::vector< int > unsatisfiedPosition_;
+  /// unsatisfied_ in order, for setupList
+  std::vector< int > sortedUnsatisfied_;
+  /// Number of nodes whose results are kept
+  int resultCacheSize_;
+  /// Kept strong branching results
+  std::vector< StrongCacheNode > resultCache_;
+  /// Counter for StrongCacheNode::lastUsed
+  int resultCacheClock_;
+  /// Number of candidates whose kept results were reused
+  int numberResultsReused_;
+  /// True if strong branching records are kept
+  bool strongStatistics_;
+  /// Strong branching records
+  std::vector< OsiStrongRecord > strongRecords_;
+  /// Number of calls of strong branching since records were cleared
+  int numberStrongCalls_;
+};
+
+/** This class chooses a variable to branch on
+
+    As OsiChooseStrong, but candidates are first screened with one dual
+    simplex pivot each.  setupList takes up to numberScreen() candidates
+    (by pseudo cost estimate as usual).  For each one whose column is basic,
+    the tableau row of that column gives, through the dual ratio test, the
+    objective change of the first pivot of the down and up branches.  The
+    numberStrong() best by that estimate are kept for full strong
+    branching with solveFromHotStart.
+
+    The estimates are lower bounds on the true change.  A branch with no
+    entering variable in the ratio test is infeasible, so such candidates
+    go to the front.  Candidates which cannot be estimated (not tied to a
+    basic column) are kept in front too.
+
+    Needs the tableau access methods (canDoSimplexInterface() at least 1)
+    and an optimal basis.  Otherwise it behaves exactly as OsiChooseStrong.
+*/
+
+class OSILIB_EXPORT OsiChooseStrongPivot : public OsiChooseStrong {
+
+public:
+  /// Default Constructor
+  OsiChooseStrongPivot();
+
+  /// Constructor from solver (so we can set up arrays etc)
+  OsiChooseStrongPivot(const OsiSolverInterface *solver);
+
+  /// Copy constructor
+  OsiChooseStrongPivot(const OsiChooseStrongPivot &);
+
+  /// Assignment operator
+  OsiChooseStrongPivot &operator=(const OsiChooseStrongPivot &rhs);
+
+  /// Clone
+  virtual OsiChooseVariable *clone() const;
+
+  /// Destructor
+  virtual ~OsiChooseStrongPivot();
+
+  /** Sets up strong list and clears all if initialize is true.
+      Returns number of infeasibilities. 
+      If returns -1 then has worked out node is infeasible!
+  */
+  virtual int setupList(OsiBranchingInformation *info, bool initialize);
+
+  /// Number of candidates screened by pivot estimates
+  inline int numberScreen() const
+  {
+    return numberScreen_;
+  }
+  /// Set number of candidates screened by pivot estimates
+  inline void setNumberScreen(int value)
+  {
+    numberScreen_ = value;
+  }
+  /// Number of candidates estimated since construction
+  inline int numberPivotEstimates() const
+  {
+    return numberPivotEstimates_;
+  }
+
+  /** Estimate the objective change of branching on objects.
+
+      For the \p number objects in \p which puts the change of the first
+      dual simplex pivot down and up in \p downEstimate and \p upEstimate
+      (COIN_DBL_MAX if that branch is infeasible, -1.0 if no estimate).
+      Returns -1 if the solver cannot do it, otherwise 0.
+  */
+  int pivotEstimates(const OsiBranchingInformation *info, int number,
+    const int *which, double *downEstimate, double *upEstimate);
+
+protected:
+  /// Number of candidates screened by pivot estimates
+  int numberScreen_;
+  /// Number of candidates estimated
+  int numberPivotEstimates_;
 };
 
 /** This class contains the result of strong branching on a variable
@@ -522,11 +970,30 @@ public:
   /// Destructor
   virtual ~OsiHotInfo();
 
+  /** Set up as the constructor from useful information would.
+
+      The branching object (see OsiObject::recreateBranch()) and arrays
+      already held are reused when possible, so an OsiHotInfo kept from one
+      node to the next does no heap allocation for simple integers.
+  */
+  void initialize(OsiSolverInterface *solver,
+    const OsiBranchingInformation *info,
+    const OsiObject *const *objects,
+    int whichObject);
+
   /** Fill in useful information after strong branch.
       Return status
   */
   int updateInformation(const OsiSolverInterface *solver, const OsiBranchingInformation *info,
     OsiChooseVariable *choose);
+  /** Fill in useful information after branch iBranch was solved elsewhere.
+      solverStatus is 0 if proven optimal, 2 if stopped on iterations and
+      otherwise 1.  solution, if not NULL, has already been checked
+      feasible for all objects.  Return status as other version.
+  */
+  int updateInformation(const OsiBranchingInformation *info,
+    OsiChooseVariable *choose, int iBranch, int iterations,
+    int solverStatus, double objectiveValue, const double *solution);
   /// Original objective value
   inline double originalObjectiveValue() const
   {
@@ -638,6 +1105,8 @@ protected:
   OsiBranchingObject *branchingObject_;
   /// Which object on list
   int whichObject_;
+  /// Number of branches the arrays have room for
+  int maximumBranches_;
 };
 
 #endif
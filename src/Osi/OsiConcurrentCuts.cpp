@@ -0,0 +1,106 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include "OsiConcurrentCuts.hpp"
+
+#if __cplusplus > 199711L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#include <atomic>
+#define OSI_CONCURRENTCUTS_ATOMIC 1
+#endif
+
+//-------------------------------------------------------------------
+// Reservation counter
+//-------------------------------------------------------------------
+#ifdef OSI_CONCURRENTCUTS_ATOMIC
+struct OsiConcurrentCuts::Counter {
+  std::atomic< int > value;
+  Counter()
+    : value(0)
+  {
+  }
+  int fetchAndIncrement() { return value.fetch_add(1); }
+  int get() const { return value.load(); }
+  void reset() { value.store(0); }
+};
+#else
+struct OsiConcurrentCuts::Counter {
+  int value;
+  Counter()
+    : value(0)
+  {
+  }
+  int fetchAndIncrement()
+  {
+#if defined(__GNUC__)
+    return __sync_fetch_and_add(&value, 1);
+#else
+    int old;
+    // without OpenMP this is not atomic (see class documentation)
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+    old = value++;
+    return old;
+#endif
+  }
+  int get() const { return value; }
+  void reset() { value = 0; }
+};
+#endif
+
+//-------------------------------------------------------------------
+// Constructor and destructor
+//-------------------------------------------------------------------
+OsiConcurrentCuts::OsiConcurrentCuts(int maximumShards)
+  : shards_(maximumShards > 0 ? maximumShards : 1)
+  , reserved_(new Counter())
+{
+}
+
+OsiConcurrentCuts::~OsiConcurrentCuts()
+{
+  delete reserved_;
+}
+
+//-------------------------------------------------------------------
+// Shards
+//-------------------------------------------------------------------
+int OsiConcurrentCuts::reserveShard()
+{
+  int iShard = reserved_->fetchAndIncrement();
+  return iShard < maximumShards() ? iShard : -1;
+}
+
+int OsiConcurrentCuts::numberReserved() const
+{
+  int number = reserved_->get();
+  return number < maximumShards() ? number : maximumShards();
+}
+
+void OsiConcurrentCuts::setPackedRowCuts(bool yesNo)
+{
+  for (int i = 0; i < maximumShards(); i++)
+    shards_[i].setPackedRowCuts(yesNo);
+}
+
+//-------------------------------------------------------------------
+// Merge all shards
+//-------------------------------------------------------------------
+int OsiConcurrentCuts::mergeInto(OsiCuts &cs, bool removeDuplicates)
+{
+  int numberDeleted = 0;
+  int numberShards = numberReserved();
+  for (int i = 0; i < numberShards; i++)
+    numberDeleted += cs.transfer(shards_[i], removeDuplicates);
+  reserved_->reset();
+  return numberDeleted;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,97 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiConcurrentCuts_H
+#define OsiConcurrentCuts_H
+
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "OsiConfig.h"
+#include "OsiCuts.hpp"
+
+/** Collection of cuts filled by several threads at once
+
+  Each thread generating cuts calls reserveShard() once to get a shard, an
+  OsiCuts of its own, and inserts its cuts there. Reserving a shard is a
+  single atomic increment, and after that no thread touches another's
+  shard, so there is no lock anywhere.
+
+  When the generators are done, mergeInto() moves the cuts of all shards
+  into one OsiCuts with OsiCuts::transfer(): cut objects change owner
+  rather than being cloned, and duplicates found across shards are
+  deleted. mergeInto() also releases the shards for the next round.
+
+  Only reserveShard() may be called concurrently. Atomicity comes from
+  std::atomic with C++11, otherwise from GCC builtins or OpenMP. A C++98
+  build with none of these has a plain increment, so there the shards
+  must be reserved from one thread only (filling them may still be done
+  in parallel).
+*/
+class OSILIB_EXPORT OsiConcurrentCuts {
+public:
+  /**@name Filling */
+  //@{
+  /** Reserve a shard for the calling thread.
+
+      Safe to call from many threads, except in a C++98 build without
+      GCC builtins or OpenMP (see above). Returns -1 if all shards are
+      taken.
+    */
+  int reserveShard();
+  /// Cuts of \p i'th shard (only to be used by the thread which reserved it)
+  inline OsiCuts &shard(int i) { return shards_[i]; }
+  /// Number of shards reserved since the last merge
+  int numberReserved() const;
+  /// Maximum number of shards
+  inline int maximumShards() const
+  {
+    return static_cast< int >(shards_.size());
+  }
+  /// Use packed storage (see OsiCuts::setPackedRowCuts()) in every shard
+  void setPackedRowCuts(bool yesNo);
+  //@}
+
+  /**@name Merging */
+  //@{
+  /** Move the cuts of all reserved shards into \p cs.
+
+      Shards are taken in order of reservation. Must not be called while
+      threads are still inserting. Returns the number of duplicate row
+      cuts deleted.
+    */
+  int mergeInto(OsiCuts &cs, bool removeDuplicates = true);
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Constructor
+  OsiConcurrentCuts(int maximumShards = 64);
+
+  /// Destructor
+  ~OsiConcurrentCuts();
+  //@}
+
+private:
+  /// Not implemented
+  OsiConcurrentCuts(const OsiConcurrentCuts &);
+  /// Not implemented
+  OsiConcurrentCuts &operator=(const OsiConcurrentCuts &);
+
+  /// Atomic counter, defined in the .cpp so the header is the same for all standards
+  struct Counter;
+
+  ///@name Private member data
+  //@{
+  /// One collection per shard
+  std::vector< OsiCuts > shards_;
+  /// Number of reservations made
+  Counter *reserved_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
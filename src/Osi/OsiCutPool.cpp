@@ -0,0 +1,433 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include <algorithm>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+#include "OsiCutPool.hpp"
+#include "OsiCuts.hpp"
+#include "OsiSolverInterface.hpp"
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+OsiCutPool::OsiCutPool(int maximumRowAge, int maximumPoolAge)
+  : numberInSolver_(0)
+  , maximumRowAge_(maximumRowAge)
+  , maximumPoolAge_(maximumPoolAge)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+OsiCutPool::OsiCutPool(const OsiCutPool &rhs)
+  : starts_(rhs.starts_)
+  , lengths_(rhs.lengths_)
+  , lower_(rhs.lower_)
+  , upper_(rhs.upper_)
+  , indices_(rhs.indices_)
+  , elements_(rhs.elements_)
+  , age_(rhs.age_)
+  , row_(rhs.row_)
+  , hashHead_(rhs.hashHead_)
+  , hashNext_(rhs.hashNext_)
+  , numberInSolver_(rhs.numberInSolver_)
+  , maximumRowAge_(rhs.maximumRowAge_)
+  , maximumPoolAge_(rhs.maximumPoolAge_)
+{
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+OsiCutPool::~OsiCutPool()
+{
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+OsiCutPool &
+OsiCutPool::operator=(const OsiCutPool &rhs)
+{
+  if (this != &rhs) {
+    starts_ = rhs.starts_;
+    lengths_ = rhs.lengths_;
+    lower_ = rhs.lower_;
+    upper_ = rhs.upper_;
+    indices_ = rhs.indices_;
+    elements_ = rhs.elements_;
+    age_ = rhs.age_;
+    row_ = rhs.row_;
+    hashHead_ = rhs.hashHead_;
+    hashNext_ = rhs.hashNext_;
+    numberInSolver_ = rhs.numberInSolver_;
+    maximumRowAge_ = rhs.maximumRowAge_;
+    maximumPoolAge_ = rhs.maximumPoolAge_;
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Add cuts
+//-------------------------------------------------------------------
+bool OsiCutPool::insert(const OsiRowCut &rc)
+{
+  if (!rc.globallyValid())
+    return false;
+  const CoinPackedVector &row = rc.row();
+  return insertCut(rc.lb(), rc.ub(), row.getNumElements(), row.getIndices(),
+    row.getElements());
+}
+
+int OsiCutPool::insert(const OsiCuts &cs)
+{
+  int numberAdded = 0;
+  int numberRowCuts = cs.sizeRowCuts();
+  for (int i = 0; i < numberRowCuts; i++) {
+    // views so packed cuts are not turned into objects
+    OsiCuts::RowCutView cut = cs.rowCutView(i);
+    if (cut.globallyValid
+      && insertCut(cut.lb, cut.ub, cut.numberElements, cut.indices,
+        cut.elements))
+      numberAdded++;
+  }
+  return numberAdded;
+}
+
+bool OsiCutPool::insertCut(double lb, double ub, int numberElements,
+  const int *indices, const double *elements)
+{
+  // keep indices sorted so equal cuts compare equal
+  CoinBigIndex start = static_cast< CoinBigIndex >(indices_.size());
+  indices_.insert(indices_.end(), indices, indices + numberElements);
+  elements_.insert(elements_.end(), elements, elements + numberElements);
+  if (numberElements)
+    CoinSort_2(&indices_[start], &indices_[start] + numberElements,
+      &elements_[start]);
+  const int *newIndices = numberElements ? &indices_[start] : NULL;
+  const double *newElements = numberElements ? &elements_[start] : NULL;
+  if (findCut(lb, ub, numberElements, newIndices, newElements) >= 0) {
+    indices_.resize(start);
+    elements_.resize(start);
+    return false;
+  }
+
+  int iCut = numberCuts();
+  starts_.push_back(start);
+  lengths_.push_back(numberElements);
+  lower_.push_back(lb);
+  upper_.push_back(ub);
+  age_.push_back(0);
+  row_.push_back(-1);
+  if (2 * numberCuts() > static_cast< int >(hashHead_.size())) {
+    rebuildIndex();
+  } else {
+    int ipos = hashCutSupport(numberElements, newIndices,
+      static_cast< int >(hashHead_.size()));
+    hashNext_.push_back(hashHead_[ipos]);
+    hashHead_[ipos] = iCut;
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------
+// Check waiting cuts against a solution
+//-------------------------------------------------------------------
+int OsiCutPool::checkWaiting(const double *solution, double minimumViolation,
+  std::vector< double > &violation)
+{
+  int n = numberCuts();
+  violation.assign(n, 0.0);
+  int numberViolated = 0;
+  for (int i = 0; i < n; i++) {
+    if (row_[i] >= 0)
+      continue;
+    const int *indices = lengths_[i] ? &indices_[starts_[i]] : NULL;
+    const double *elements = lengths_[i] ? &elements_[starts_[i]] : NULL;
+    double sum = 0.0;
+    for (int j = 0; j < lengths_[i]; j++)
+      sum += elements[j] * solution[indices[j]];
+    double infeasibility = 0.0;
+    if (sum > upper_[i])
+      infeasibility = sum - upper_[i];
+    else if (sum < lower_[i])
+      infeasibility = lower_[i] - sum;
+    if (infeasibility > minimumViolation) {
+      violation[i] = infeasibility;
+      age_[i] = 0;
+      numberViolated++;
+    } else {
+      age_[i]++;
+    }
+  }
+  return numberViolated;
+}
+
+int OsiCutPool::separate(const double *solution, OsiCuts &cs,
+  double minimumViolation)
+{
+  std::vector< double > violation;
+  int numberViolated = checkWaiting(solution, minimumViolation, violation);
+  if (!numberViolated)
+    return 0;
+  int n = numberCuts();
+  for (int i = 0; i < n; i++) {
+    if (violation[i] > 0.0) {
+      OsiRowCut rc = rowCut(i);
+      rc.setEffectiveness(violation[i]);
+      cs.insert(rc);
+    }
+  }
+  return numberViolated;
+}
+
+int OsiCutPool::applyViolatedCuts(OsiSolverInterface &si,
+  double minimumViolation)
+{
+  const double *solution = si.getColSolution();
+  if (!solution)
+    return 0;
+  std::vector< double > violation;
+  int numberViolated = checkWaiting(solution, minimumViolation, violation);
+  if (!numberViolated)
+    return 0;
+
+  // gather the violated cuts into one block
+  int n = numberCuts();
+  std::vector< CoinBigIndex > starts;
+  std::vector< int > indices;
+  std::vector< double > elements;
+  std::vector< double > lower;
+  std::vector< double > upper;
+  starts.reserve(numberViolated + 1);
+  starts.push_back(0);
+  int iRow = si.getNumRows();
+  for (int i = 0; i < n; i++) {
+    if (violation[i] > 0.0) {
+      CoinBigIndex start = starts_[i];
+      indices.insert(indices.end(), indices_.begin() + start,
+        indices_.begin() + start + lengths_[i]);
+      elements.insert(elements.end(), elements_.begin() + start,
+        elements_.begin() + start + lengths_[i]);
+      starts.push_back(static_cast< CoinBigIndex >(indices.size()));
+      lower.push_back(lower_[i]);
+      upper.push_back(upper_[i]);
+      row_[i] = iRow++;
+    }
+  }
+  si.addRows(numberViolated, &starts[0],
+    indices.size() ? &indices[0] : NULL,
+    elements.size() ? &elements[0] : NULL, &lower[0], &upper[0]);
+  numberInSolver_ += numberViolated;
+  return numberViolated;
+}
+
+//-------------------------------------------------------------------
+// Age rows in solver and delete old ones
+//-------------------------------------------------------------------
+int OsiCutPool::purgeRows(OsiSolverInterface &si, double tolerance)
+{
+  if (!numberInSolver_)
+    return 0;
+  const double *activity = si.getRowActivity();
+  int numberRows = si.getNumRows();
+  int n = numberCuts();
+  std::vector< int > deleted;
+  int i;
+  for (i = 0; i < n; i++) {
+    int iRow = row_[i];
+    if (iRow < 0)
+      continue;
+    if (iRow >= numberRows) {
+      // row went some other way
+      row_[i] = -1;
+      numberInSolver_--;
+      continue;
+    }
+    double value = activity[iRow];
+    if (value <= lower_[i] + tolerance || value >= upper_[i] - tolerance) {
+      age_[i] = 0;
+    } else if (++age_[i] > maximumRowAge_) {
+      deleted.push_back(iRow);
+      row_[i] = -1;
+      age_[i] = 0;
+      numberInSolver_--;
+    }
+  }
+  int numberDeleted = static_cast< int >(deleted.size());
+  if (!numberDeleted)
+    return 0;
+  std::sort(deleted.begin(), deleted.end());
+  si.deleteRows(numberDeleted, &deleted[0]);
+  // renumber rows still in solver
+  for (i = 0; i < n; i++) {
+    int iRow = row_[i];
+    if (iRow >= 0) {
+      int shift = static_cast< int >(
+        std::lower_bound(deleted.begin(), deleted.end(), iRow)
+        - deleted.begin());
+      row_[i] = iRow - shift;
+    }
+  }
+  return numberDeleted;
+}
+
+//-------------------------------------------------------------------
+// Drop old waiting cuts
+//-------------------------------------------------------------------
+int OsiCutPool::purge()
+{
+  int n = numberCuts();
+  int numberKept = 0;
+  CoinBigIndex put = 0;
+  for (int i = 0; i < n; i++) {
+    if (row_[i] < 0 && age_[i] > maximumPoolAge_)
+      continue;
+    CoinBigIndex start = starts_[i];
+    int length = lengths_[i];
+    // moving down so overlapping copies are safe
+    for (int j = 0; j < length; j++) {
+      indices_[put + j] = indices_[start + j];
+      elements_[put + j] = elements_[start + j];
+    }
+    starts_[numberKept] = put;
+    lengths_[numberKept] = length;
+    lower_[numberKept] = lower_[i];
+    upper_[numberKept] = upper_[i];
+    age_[numberKept] = age_[i];
+    row_[numberKept] = row_[i];
+    numberKept++;
+    put += length;
+  }
+  int numberDropped = n - numberKept;
+  if (numberDropped) {
+    starts_.resize(numberKept);
+    lengths_.resize(numberKept);
+    lower_.resize(numberKept);
+    upper_.resize(numberKept);
+    age_.resize(numberKept);
+    row_.resize(numberKept);
+    indices_.resize(put);
+    elements_.resize(put);
+    rebuildIndex();
+  }
+  return numberDropped;
+}
+
+//-------------------------------------------------------------------
+// Binary files
+//-------------------------------------------------------------------
+int OsiCutPool::writeBinary(FILE *fp) const
+{
+  OsiCuts cs;
+  cs.setPackedRowCuts(true);
+  int n = numberCuts();
+  for (int i = 0; i < n; i++) {
+    CoinBigIndex start = starts_[i];
+    cs.emplaceRowCut(lower_[i], upper_[i], lengths_[i],
+      lengths_[i] ? &indices_[start] : NULL,
+      lengths_[i] ? &elements_[start] : NULL, 0.0, true);
+  }
+  return cs.writeBinary(fp);
+}
+
+int OsiCutPool::readBinary(FILE *fp)
+{
+  OsiCuts cs;
+  cs.setPackedRowCuts(true);
+  int returnCode = cs.readBinary(fp);
+  insert(cs);
+  return returnCode;
+}
+
+void OsiCutPool::clearRows()
+{
+  std::fill(row_.begin(), row_.end(), -1);
+  numberInSolver_ = 0;
+}
+
+void OsiCutPool::clear()
+{
+  starts_.clear();
+  lengths_.clear();
+  lower_.clear();
+  upper_.clear();
+  indices_.clear();
+  elements_.clear();
+  age_.clear();
+  row_.clear();
+  hashHead_.clear();
+  hashNext_.clear();
+  numberInSolver_ = 0;
+}
+
+//-------------------------------------------------------------------
+// Get a copy of a cut
+//-------------------------------------------------------------------
+OsiRowCut OsiCutPool::rowCut(int i) const
+{
+  OsiRowCut rc;
+  CoinBigIndex start = starts_[i];
+  if (lengths_[i])
+    rc.setRow(lengths_[i], &indices_[start], &elements_[start], false);
+  rc.setLb(lower_[i]);
+  rc.setUb(upper_[i]);
+  rc.setGloballyValid(true);
+  return rc;
+}
+
+//-------------------------------------------------------------------
+// Hash index
+//-------------------------------------------------------------------
+int OsiCutPool::findCut(double lb, double ub, int numberElements,
+  const int *indices, const double *elements) const
+{
+  if (hashHead_.empty())
+    return -1;
+  CoinAbsFltEq treatAsSame(1.0e-12);
+  int ipos = hashCutSupport(numberElements, indices,
+    static_cast< int >(hashHead_.size()));
+  for (int i = hashHead_[ipos]; i >= 0; i = hashNext_[i]) {
+    if (lengths_[i] != numberElements)
+      continue;
+    if (!treatAsSame(lower_[i], lb) || !treatAsSame(upper_[i], ub))
+      continue;
+    CoinBigIndex start = starts_[i];
+    int j;
+    for (j = 0; j < numberElements; j++) {
+      if (indices_[start + j] != indices[j])
+        break;
+      if (!treatAsSame(elements_[start + j], elements[j]))
+        break;
+    }
+    if (j == numberElements)
+      return i;
+  }
+  return -1;
+}
+
+void OsiCutPool::rebuildIndex()
+{
+  int n = numberCuts();
+  int numberBuckets = CoinMax(1024, 4 * n);
+  hashHead_.assign(numberBuckets, -1);
+  hashNext_.assign(n, -1);
+  for (int i = 0; i < n; i++) {
+    const int *indices = lengths_[i] ? &indices_[starts_[i]] : NULL;
+    int ipos = hashCutSupport(lengths_[i], indices, numberBuckets);
+    hashNext_[i] = hashHead_[ipos];
+    hashHead_[ipos] = i;
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,198 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiCutPool_H
+#define OsiCutPool_H
+
+#include <cstdio>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "OsiConfig.h"
+#include "OsiRowCut.hpp"
+
+class OsiCuts;
+class OsiSolverInterface;
+
+/** Pool of globally valid row cuts kept across nodes and rounds
+
+  OsiCuts is meant to hold the cuts of one round. OsiCutPool keeps
+  globally valid row cuts (OsiCut::globallyValid()) for as long as they
+  look useful, so that a cut found once does not have to be generated
+  again.
+
+  Each cut in the pool is either in the solver, as a row added by
+  applyViolatedCuts(), or waiting. Both kinds are aged:
+  <ul>
+    <li> purgeRows() looks at the activity of the rows in the solver.
+     A row which is tight has its age reset, otherwise the age goes
+     up. Rows older than maximumRowAge() are deleted from the solver
+     (all in one deleteRows call) but the cuts stay in the pool.
+    <li> separate() and applyViolatedCuts() check the waiting cuts
+     against a solution. A violated cut has its age reset, otherwise
+     the age goes up. purge() drops waiting cuts older than
+     maximumPoolAge().
+  </ul>
+  The coefficients are held in one row ordered block, so checking the
+  whole pool against a solution is a single pass over contiguous memory.
+
+  The pool remembers the row index of each cut it put in the solver.
+  If rows before those are deleted by other means, call clearRows()
+  (for example after OsiSolverInterface::restoreBaseModel()).
+*/
+class OSILIB_EXPORT OsiCutPool {
+#ifdef OSICOMMONTESTLIB_EXPORT
+  friend OSICOMMONTESTLIB_EXPORT void OsiCutPoolUnitTest();
+#endif
+
+public:
+  /**@name Adding cuts */
+  //@{
+  /** Add a row cut.
+
+      Cuts which are not globally valid, and cuts already in the pool,
+      are ignored. Returns true if the cut was added.
+    */
+  bool insert(const OsiRowCut &rc);
+  /// Add the globally valid row cuts of \p cs. Returns number added.
+  int insert(const OsiCuts &cs);
+  //@}
+
+  /**@name Using the pool */
+  //@{
+  /** Put waiting cuts violated by \p solution into \p cs.
+
+      Violation is as OsiRowCut::violated(); cuts with a violation above
+      \p minimumViolation are added to \p cs (with the violation as
+      effectiveness) and have their age reset, the others get older.
+      The pool does not learn whether the caller adds these cuts to a
+      solver. Returns the number of cuts added to \p cs.
+    */
+  int separate(const double *solution, OsiCuts &cs,
+    double minimumViolation = 1.0e-6);
+  /** Add waiting cuts violated by the current solution of \p si as rows.
+
+      As separate() against si.getColSolution(), but the violated cuts
+      are added to \p si with a single addRows call and the pool records
+      their rows. Returns the number of rows added.
+    */
+  int applyViolatedCuts(OsiSolverInterface &si,
+    double minimumViolation = 1.0e-6);
+  /** Age the pool rows in \p si and delete the old ones.
+
+      A row whose activity is within \p tolerance of one of its bounds
+      is tight. Returns the number of rows deleted.
+    */
+  int purgeRows(OsiSolverInterface &si, double tolerance = 1.0e-7);
+  /** Drop waiting cuts older than maximumPoolAge().
+
+      Returns the number of cuts dropped.
+    */
+  int purge();
+  /** Write the cuts in OsiCuts binary form (see OsiCuts::writeBinary()).
+      Ages and rows are not written. Returns 0 on success. */
+  int writeBinary(FILE *fp) const;
+  /** Add the cuts of an OsiCuts binary file.
+      Returns as OsiCuts::readBinary(FILE *). */
+  int readBinary(FILE *fp);
+  /// Forget which cuts are in the solver (the cuts stay in the pool)
+  void clearRows();
+  /// Remove all cuts
+  void clear();
+  //@}
+
+  /**@name Query */
+  //@{
+  /// Number of cuts in pool
+  inline int numberCuts() const
+  {
+    return static_cast< int >(lower_.size());
+  }
+  /// Number of cuts which are rows in the solver
+  inline int numberInSolver() const { return numberInSolver_; }
+  /// Row of i'th cut in the solver (-1 if waiting)
+  inline int row(int i) const { return row_[i]; }
+  /// Age of i'th cut
+  inline int age(int i) const { return age_[i]; }
+  /// Get a copy of i'th cut
+  OsiRowCut rowCut(int i) const;
+  //@}
+
+  /**@name Parameters */
+  //@{
+  /// Rounds a row may stay slack before it is deleted from the solver
+  inline int maximumRowAge() const { return maximumRowAge_; }
+  inline void setMaximumRowAge(int value) { maximumRowAge_ = value; }
+  /// Rounds a waiting cut may go unviolated before it is dropped
+  inline int maximumPoolAge() const { return maximumPoolAge_; }
+  inline void setMaximumPoolAge(int value) { maximumPoolAge_ = value; }
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  OsiCutPool(int maximumRowAge = 5, int maximumPoolAge = 50);
+
+  /// Copy constructor
+  OsiCutPool(const OsiCutPool &);
+
+  /// Assignment operator
+  OsiCutPool &operator=(const OsiCutPool &rhs);
+
+  /// Destructor
+  virtual ~OsiCutPool();
+  //@}
+
+private:
+  /**@name Private methods */
+  //@{
+  /** Compute the violation of every waiting cut, update ages and return
+      the number violated. Violations go in \p violation. */
+  int checkWaiting(const double *solution, double minimumViolation,
+    std::vector< double > &violation);
+  /// Add a cut unless it is already there
+  bool insertCut(double lb, double ub, int n, const int *indices,
+    const double *elements);
+  /// Index of a cut equal to the given one, or -1
+  int findCut(double lb, double ub, int n, const int *indices,
+    const double *elements) const;
+  /// Rebuild hash index over all cuts
+  void rebuildIndex();
+  //@}
+
+  ///@name Private member data
+  //@{
+  /// Start of each cut in indices_ and elements_
+  std::vector< CoinBigIndex > starts_;
+  /// Number of elements in each cut
+  std::vector< int > lengths_;
+  /// Lower bounds
+  std::vector< double > lower_;
+  /// Upper bounds
+  std::vector< double > upper_;
+  /// Column indices, each cut sorted
+  std::vector< int > indices_;
+  /// Coefficients
+  std::vector< double > elements_;
+  /// Age of each cut
+  std::vector< int > age_;
+  /// Row of each cut in the solver or -1
+  std::vector< int > row_;
+  /// First cut in each hash bucket (-1 if none)
+  std::vector< int > hashHead_;
+  /// Next cut in same hash bucket
+  std::vector< int > hashNext_;
+  /// Number of cuts with a row in the solver
+  int numberInSolver_;
+  /// See maximumRowAge()
+  int maximumRowAge_;
+  /// See maximumPoolAge()
+  int maximumPoolAge_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -9,7 +9,16 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstring>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
+#include "CoinHelperFunctions.hpp"
 #include "OsiCuts.hpp"
 
 //-------------------------------------------------------------------
@@ -18,6 +27,19 @@
 OsiCuts::OsiCuts()
   : rowCutPtrs_()
   , colCutPtrs_()
+  , rowCutHashHead_()
+  , rowCutHashNext_()
+  , rowCutHashBucket_()
+  , rowCutIndexChanged_()
+  , packedRowCuts_(false)
+  , rowCutStarts_()
+  , rowCutLengths_()
+  , rowCutLower_()
+  , rowCutUpper_()
+  , rowCutEffectiveness_()
+  , rowCutGloballyValid_()
+  , rowCutIndices_()
+  , rowCutElements_()
 {
   // nothing to do here
 }
@@ -28,6 +50,19 @@ OsiCuts::OsiCuts()
 OsiCuts::OsiCuts(const OsiCuts &source)
   : rowCutPtrs_()
   , colCutPtrs_()
+  , rowCutHashHead_()
+  , rowCutHashNext_()
+  , rowCutHashBucket_()
+  , rowCutIndexChanged_()
+  , packedRowCuts_(false)
+  , rowCutStarts_()
+  , rowCutLengths_()
+  , rowCutLower_()
+  , rowCutUpper_()
+  , rowCutEffectiveness_()
+  , rowCutGloballyValid_()
+  , rowCutIndices_()
+  , rowCutElements_()
 {
   gutsOfCopy(source);
 }
@@ -61,8 +96,17 @@ void OsiCuts::gutsOfCopy(const OsiCuts &source)
   assert(sizeCuts() == 0);
   int i;
   int ne = source.sizeRowCuts();
-  for (i = 0; i < ne; i++)
-    insert(source.rowCut(i));
+  packedRowCuts_ = source.packedRowCuts_;
+  for (i = 0; i < ne; i++) {
+    const OsiRowCut *cutPtr = source.rowCutPtrs_[i];
+    if (cutPtr) {
+      insert(*cutPtr);
+    } else {
+      RowCutView cut = source.rowCutView(i);
+      appendPackedRowCut(cut.lb, cut.ub, cut.numberElements, cut.indices,
+        cut.elements, cut.effectiveness, cut.globallyValid);
+    }
+  }
   ne = source.sizeColCuts();
   for (i = 0; i < ne; i++)
     insert(source.colCut(i));
@@ -73,12 +117,14 @@ void OsiCuts::gutsOfDestructor()
 {
   int i;
 
+  invalidateRowCutIndex();
   int ne = static_cast< int >(rowCutPtrs_.size());
   for (i = 0; i < ne; i++) {
-    if (rowCutPtrs_[i]->globallyValidAsInteger() != 2)
+    if (rowCutPtrs_[i] && rowCutPtrs_[i]->globallyValidAsInteger() != 2)
       delete rowCutPtrs_[i];
   }
   rowCutPtrs_.clear();
+  clearPackedRowCuts();
 
   ne = static_cast< int >(colCutPtrs_.size());
   for (i = 0; i < ne; i++) {
@@ -279,30 +325,865 @@ OsiCuts::const_iterator OsiCuts::const_iterator::operator++()
   return *this;
 }
 
-/* Insert a row cut unless it is a duplicate (CoinAbsFltEq)
-       returns true if inserted */
-bool OsiCuts::insertIfNotDuplicate(OsiRowCut &rc, CoinAbsFltEq treatAsSame)
+//-------------------------------------------------------------------
+// Packed storage of row cuts
+//-------------------------------------------------------------------
+void OsiCuts::setPackedRowCuts(bool yesNo)
 {
-  double newLb = rc.lb();
-  double newUb = rc.ub();
-  CoinPackedVector vector = rc.row();
-  int numberElements = vector.getNumElements();
-  int *newIndices = vector.getIndices();
-  double *newElements = vector.getElements();
-  CoinSort_2(newIndices, newIndices + numberElements, newElements);
-  bool notDuplicate = true;
+  if (yesNo == packedRowCuts_)
+    return;
   int numberRowCuts = sizeRowCuts();
+  if (yesNo) {
+    // existing cuts stay as objects
+    rowCutStarts_.assign(numberRowCuts, 0);
+    rowCutLengths_.assign(numberRowCuts, 0);
+    rowCutLower_.assign(numberRowCuts, 0.0);
+    rowCutUpper_.assign(numberRowCuts, 0.0);
+    rowCutEffectiveness_.assign(numberRowCuts, 0.0);
+    rowCutGloballyValid_.assign(numberRowCuts, 0);
+    rowCutElementStarts_.assign(numberRowCuts, 0);
+  } else {
+    for (int i = 0; i < numberRowCuts; i++) {
+      if (!rowCutPtrs_[i])
+        unpackRowCut(i);
+    }
+    clearPackedRowCuts();
+  }
+  packedRowCuts_ = yesNo;
+}
+
+void OsiCuts::appendPackedRowCut(double lb, double ub, int numberElements,
+  const int *indices, const double *elements,
+  double effectiveness, int globallyValid)
+{
+  assert(packedRowCuts_);
+  CoinBigIndex start = static_cast< CoinBigIndex >(rowCutIndices_.size());
+  rowCutStarts_.push_back(start);
+  rowCutLengths_.push_back(numberElements);
+  rowCutLower_.push_back(lb);
+  rowCutUpper_.push_back(ub);
+  rowCutEffectiveness_.push_back(effectiveness);
+  rowCutGloballyValid_.push_back(globallyValid);
+  rowCutPtrs_.push_back(NULL);
+  int numberPositive = unitCoefficients(numberElements, elements);
+  if (numberPositive < 0) {
+    rowCutElementStarts_.push_back(
+      static_cast< CoinBigIndex >(rowCutElements_.size()));
+    rowCutIndices_.insert(rowCutIndices_.end(), indices,
+      indices + numberElements);
+    rowCutElements_.insert(rowCutElements_.end(), elements,
+      elements + numberElements);
+    return;
+  }
+  // +1 columns first then -1 columns, coefficients are not stored
+  rowCutElementStarts_.push_back(-1 - numberPositive);
+  rowCutIndices_.resize(start + numberElements);
+  int *put = &rowCutIndices_[start];
+  int nPositive = 0;
+  int nNegative = numberPositive;
+  for (int j = 0; j < numberElements; j++) {
+    if (elements[j] > 0.0)
+      put[nPositive++] = indices[j];
+    else
+      put[nNegative++] = indices[j];
+  }
+  int numberUnit = static_cast< int >(rowCutUnitElements_.size() / 2);
+  if (numberElements > numberUnit) {
+    numberUnit = CoinMax(numberElements, 2 * numberUnit);
+    rowCutUnitElements_.assign(numberUnit, 1.0);
+    rowCutUnitElements_.resize(2 * numberUnit, -1.0);
+  }
+}
+
+/* Returns number of +1.0 coefficients if all coefficients are +1.0 or
+   -1.0, otherwise -1. */
+int OsiCuts::unitCoefficients(int numberElements, const double *elements)
+{
+  if (!numberElements)
+    return -1;
+  int numberPositive = 0;
+  for (int j = 0; j < numberElements; j++) {
+    if (elements[j] == 1.0)
+      numberPositive++;
+    else if (elements[j] != -1.0)
+      return -1;
+  }
+  return numberPositive;
+}
+
+/* Put a row into the order a packed cut with +1/-1 coefficients is
+   stored in, so duplicates can be found. Order within each sign is kept. */
+void OsiCuts::orderUnitCoefficients(int numberElements, int *indices,
+  double *elements) const
+{
+  if (!packedRowCuts_)
+    return;
+  int numberPositive = unitCoefficients(numberElements, elements);
+  if (numberPositive <= 0 || numberPositive == numberElements)
+    return;
+  std::vector< int > negative;
+  negative.reserve(numberElements - numberPositive);
+  int nPositive = 0;
+  for (int j = 0; j < numberElements; j++) {
+    if (elements[j] > 0.0)
+      indices[nPositive++] = indices[j];
+    else
+      negative.push_back(indices[j]);
+  }
+  for (int j = 0; j < numberElements - numberPositive; j++) {
+    indices[numberPositive + j] = negative[j];
+    elements[numberPositive + j] = -1.0;
+  }
+  for (int j = 0; j < numberPositive; j++)
+    elements[j] = 1.0;
+}
+
+/* Const readers on several threads may ask for the same cut, so it is
+   created under a lock.  A cut already created is returned without taking
+   the lock; the pointer is only stored once the object is complete. */
+OsiRowCut *OsiCuts::unpackRowCut(int i) const
+{
+  assert(packedRowCuts_);
+  OsiRowCut *cut = rowCutPtrs_[i];
+  if (cut)
+    return cut;
+#ifdef _OPENMP
+#pragma omp critical(OsiCutsUnpackRowCut)
+#endif
+  {
+    cut = rowCutPtrs_[i];
+    if (!cut) {
+      cut = new OsiRowCut();
+      int numberElements = rowCutLengths_[i];
+      if (numberElements) {
+        RowCutView view = rowCutView(i);
+        cut->setRow(numberElements, view.indices, view.elements, false);
+      }
+      cut->setLb(rowCutLower_[i]);
+      cut->setUb(rowCutUpper_[i]);
+      cut->setEffectiveness(rowCutEffectiveness_[i]);
+      cut->setGloballyValidAsInteger(rowCutGloballyValid_[i]);
+#ifdef _OPENMP
+#pragma omp flush
+#endif
+      rowCutPtrs_[i] = cut;
+    }
+  }
+  return cut;
+}
+
+void OsiCuts::erasePackedRowCut(int i)
+{
+  rowCutStarts_.erase(rowCutStarts_.begin() + i);
+  rowCutLengths_.erase(rowCutLengths_.begin() + i);
+  rowCutLower_.erase(rowCutLower_.begin() + i);
+  rowCutUpper_.erase(rowCutUpper_.begin() + i);
+  rowCutEffectiveness_.erase(rowCutEffectiveness_.begin() + i);
+  rowCutGloballyValid_.erase(rowCutGloballyValid_.begin() + i);
+  rowCutElementStarts_.erase(rowCutElementStarts_.begin() + i);
+  // give back dead space once it is more than half the coefficient arrays
+  CoinBigIndex numberLive = 0;
+  for (size_t k = 0; k < rowCutLengths_.size(); k++)
+    numberLive += rowCutLengths_[k];
+  CoinBigIndex numberStored = static_cast< CoinBigIndex >(rowCutIndices_.size());
+  if (!numberLive || (numberStored > 1024 && 2 * numberLive < numberStored))
+    compactPackedRowCuts();
+}
+
+/* Copy the coefficients of the cuts still there into new arrays.  After
+   sortPackedRowCuts() the starts need not increase, so nothing is moved in
+   place. */
+void OsiCuts::compactPackedRowCuts()
+{
+  int numberCuts = static_cast< int >(rowCutStarts_.size());
+  std::vector< int > indices;
+  std::vector< double > elements;
+  CoinBigIndex numberIndices = 0;
+  CoinBigIndex numberElements = 0;
+  int i;
+  for (i = 0; i < numberCuts; i++) {
+    numberIndices += rowCutLengths_[i];
+    if (rowCutElementStarts_[i] >= 0)
+      numberElements += rowCutLengths_[i];
+  }
+  indices.reserve(numberIndices);
+  elements.reserve(numberElements);
+  for (i = 0; i < numberCuts; i++) {
+    int n = rowCutLengths_[i];
+    CoinBigIndex start = rowCutStarts_[i];
+    rowCutStarts_[i] = static_cast< CoinBigIndex >(indices.size());
+    indices.insert(indices.end(), rowCutIndices_.begin() + start,
+      rowCutIndices_.begin() + start + n);
+    CoinBigIndex elementStart = rowCutElementStarts_[i];
+    if (elementStart >= 0) {
+      rowCutElementStarts_[i] = static_cast< CoinBigIndex >(elements.size());
+      elements.insert(elements.end(), rowCutElements_.begin() + elementStart,
+        rowCutElements_.begin() + elementStart + n);
+    }
+  }
+  rowCutIndices_.swap(indices);
+  rowCutElements_.swap(elements);
+}
+
+void OsiCuts::clearPackedRowCuts()
+{
+  rowCutStarts_.clear();
+  rowCutLengths_.clear();
+  rowCutLower_.clear();
+  rowCutUpper_.clear();
+  rowCutEffectiveness_.clear();
+  rowCutGloballyValid_.clear();
+  rowCutElementStarts_.clear();
+  rowCutIndices_.clear();
+  rowCutElements_.clear();
+}
+
+/* Sort a permutation by effectiveness and apply it to the pointers and the
+   per cut packed arrays.  Coefficients are not moved. */
+void OsiCuts::sortPackedRowCuts()
+{
+  int numberRowCuts = sizeRowCuts();
+  if (!numberRowCuts)
+    return;
+  std::vector< double > sortKey(numberRowCuts);
+  std::vector< int > order(numberRowCuts);
+  for (int i = 0; i < numberRowCuts; i++) {
+    const OsiRowCut *cutPtr = rowCutPtrs_[i];
+    sortKey[i] = cutPtr ? cutPtr->effectiveness() : rowCutEffectiveness_[i];
+    order[i] = i;
+  }
+  CoinSort_2(&sortKey[0], &sortKey[0] + numberRowCuts, &order[0],
+    CoinFirstGreater_2< double, int >());
+  OsiVectorRowCutPtr ptrs(numberRowCuts);
+  std::vector< CoinBigIndex > starts(numberRowCuts);
+  std::vector< int > lengths(numberRowCuts);
+  std::vector< double > lower(numberRowCuts);
+  std::vector< double > upper(numberRowCuts);
+  std::vector< double > effectiveness(numberRowCuts);
+  std::vector< int > globallyValid(numberRowCuts);
+  std::vector< CoinBigIndex > elementStarts(numberRowCuts);
   for (int i = 0; i < numberRowCuts; i++) {
-    const OsiRowCut *cutPtr = rowCutPtr(i);
-    if (cutPtr->row().getNumElements() != numberElements)
+    int k = order[i];
+    ptrs[i] = rowCutPtrs_[k];
+    starts[i] = rowCutStarts_[k];
+    lengths[i] = rowCutLengths_[k];
+    lower[i] = rowCutLower_[k];
+    upper[i] = rowCutUpper_[k];
+    effectiveness[i] = rowCutEffectiveness_[k];
+    globallyValid[i] = rowCutGloballyValid_[k];
+    elementStarts[i] = rowCutElementStarts_[k];
+  }
+  rowCutPtrs_.swap(ptrs);
+  rowCutStarts_.swap(starts);
+  rowCutLengths_.swap(lengths);
+  rowCutLower_.swap(lower);
+  rowCutUpper_.swap(upper);
+  rowCutEffectiveness_.swap(effectiveness);
+  rowCutGloballyValid_.swap(globallyValid);
+  rowCutElementStarts_.swap(elementStarts);
+}
+
+OsiCuts::RowCutView OsiCuts::rowCutView(int i) const
+{
+  RowCutView view;
+  const OsiRowCut *cutPtr = rowCutPtrs_[i];
+  if (cutPtr) {
+    const CoinPackedVector &row = cutPtr->row();
+    view.numberElements = row.getNumElements();
+    view.indices = row.getIndices();
+    view.elements = row.getElements();
+    view.lb = cutPtr->lb();
+    view.ub = cutPtr->ub();
+    view.effectiveness = cutPtr->effectiveness();
+    view.globallyValid = cutPtr->globallyValidAsInteger();
+  } else {
+    CoinBigIndex start = rowCutStarts_[i];
+    view.numberElements = rowCutLengths_[i];
+    view.indices = view.numberElements ? &rowCutIndices_[start] : NULL;
+    CoinBigIndex elementStart = rowCutElementStarts_[i];
+    if (!view.numberElements) {
+      view.elements = NULL;
+    } else if (elementStart >= 0) {
+      view.elements = &rowCutElements_[elementStart];
+    } else {
+      // +1.0 coefficients then -1.0 coefficients
+      int numberPositive = static_cast< int >(-1 - elementStart);
+      int numberUnit = static_cast< int >(rowCutUnitElements_.size() / 2);
+      view.elements = &rowCutUnitElements_[numberUnit - numberPositive];
+    }
+    view.lb = rowCutLower_[i];
+    view.ub = rowCutUpper_[i];
+    view.effectiveness = rowCutEffectiveness_[i];
+    view.globallyValid = rowCutGloballyValid_[i];
+  }
+  return view;
+}
+
+//-------------------------------------------------------------------
+// Insert a set of cuts
+//-------------------------------------------------------------------
+// LANNEZ SEBASTIEN added Thu May 25 01:22:51 EDT 2006
+void OsiCuts::insert(const OsiCuts &cs)
+{
+  // Row and column cuts are held apart, so no need to find out the type
+  int i;
+  int numberRowCuts = cs.sizeRowCuts();
+  for (i = 0; i < numberRowCuts; i++) {
+    const OsiRowCut *rCut = cs.rowCutPtrs_[i];
+    if (rCut) {
+      insert(*rCut);
+    } else if (packedRowCuts_) {
+      RowCutView cut = cs.rowCutView(i);
+      appendPackedRowCut(cut.lb, cut.ub, cut.numberElements, cut.indices,
+        cut.elements, cut.effectiveness, cut.globallyValid);
+    } else {
+      insert(cs.rowCut(i));
+    }
+  }
+  int numberColCuts = cs.sizeColCuts();
+  for (i = 0; i < numberColCuts; i++)
+    insert(*cs.colCutPtrs_[i]);
+}
+
+//-------------------------------------------------------------------
+// Move cuts from another collection
+//-------------------------------------------------------------------
+int OsiCuts::transfer(OsiCuts &cs, bool removeDuplicates)
+{
+  if (&cs == this)
+    return 0;
+  CoinAbsFltEq treatAsSame(1.0e-12);
+  int numberDeleted = 0;
+  std::vector< int > sortedIndices;
+  std::vector< double > sortedElements;
+  int numberRowCuts = cs.sizeRowCuts();
+  for (int i = 0; i < numberRowCuts; i++) {
+    OsiRowCut *cutPtr = cs.rowCutPtrs_[i];
+    if (cutPtr) {
+      if (removeDuplicates) {
+        CoinPackedVector &row = cutPtr->mutableRow();
+        row.sortIncrIndex();
+        orderUnitCoefficients(row.getNumElements(), row.getIndices(),
+          row.getElements());
+        if (findDuplicateRowCut(cutPtr->lb(), cutPtr->ub(),
+              row.getNumElements(), row.getIndices(), row.getElements(),
+              treatAsSame)
+          >= 0) {
+          // a cut with globallyValid 2 is owned elsewhere
+          if (cutPtr->globallyValidAsInteger() != 2)
+            delete cutPtr;
+          numberDeleted++;
+          continue;
+        }
+      }
+      insert(cutPtr);
+    } else {
+      // packed in cs
+      RowCutView cut = cs.rowCutView(i);
+      int numberElements = cut.numberElements;
+      const int *indices = cut.indices;
+      const double *elements = cut.elements;
+      if (removeDuplicates && numberElements) {
+        sortedIndices.assign(indices, indices + numberElements);
+        sortedElements.assign(elements, elements + numberElements);
+        CoinSort_2(&sortedIndices[0], &sortedIndices[0] + numberElements,
+          &sortedElements[0]);
+        orderUnitCoefficients(numberElements, &sortedIndices[0],
+          &sortedElements[0]);
+        indices = &sortedIndices[0];
+        elements = &sortedElements[0];
+      }
+      if (removeDuplicates
+        && findDuplicateRowCut(cut.lb, cut.ub, numberElements, indices,
+             elements, treatAsSame)
+          >= 0) {
+        numberDeleted++;
+        continue;
+      }
+      if (packedRowCuts_) {
+        appendPackedRowCut(cut.lb, cut.ub, numberElements, indices, elements,
+          cut.effectiveness, cut.globallyValid);
+      } else {
+        OsiRowCut *newCutPtr = new OsiRowCut();
+        if (numberElements)
+          newCutPtr->setRow(numberElements, indices, elements, false);
+        newCutPtr->setLb(cut.lb);
+        newCutPtr->setUb(cut.ub);
+        newCutPtr->setEffectiveness(cut.effectiveness);
+        newCutPtr->setGloballyValidAsInteger(cut.globallyValid);
+        insert(newCutPtr);
+      }
+    }
+  }
+  cs.rowCutPtrs_.clear();
+  cs.clearPackedRowCuts();
+  cs.invalidateRowCutIndex();
+  colCutPtrs_.insert(colCutPtrs_.end(), cs.colCutPtrs_.begin(),
+    cs.colCutPtrs_.end());
+  cs.colCutPtrs_.clear();
+  return numberDeleted;
+}
+
+//-------------------------------------------------------------------
+// Violation (and efficacy) of all row cuts
+//-------------------------------------------------------------------
+namespace {
+// Activity and squared norm of one cut. Four partial sums break the
+// dependency chain so the compiler can keep several products in flight.
+inline void cutActivity(int n, const int *indices, const double *elements,
+  const double *solution, double &activity, double &normSquared)
+{
+  double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+  double norm0 = 0.0, norm1 = 0.0, norm2 = 0.0, norm3 = 0.0;
+  int j = 0;
+  for (; j + 3 < n; j += 4) {
+    double e0 = elements[j];
+    double e1 = elements[j + 1];
+    double e2 = elements[j + 2];
+    double e3 = elements[j + 3];
+    sum0 += e0 * solution[indices[j]];
+    sum1 += e1 * solution[indices[j + 1]];
+    sum2 += e2 * solution[indices[j + 2]];
+    sum3 += e3 * solution[indices[j + 3]];
+    norm0 += e0 * e0;
+    norm1 += e1 * e1;
+    norm2 += e2 * e2;
+    norm3 += e3 * e3;
+  }
+  for (; j < n; j++) {
+    double e = elements[j];
+    sum0 += e * solution[indices[j]];
+    norm0 += e * e;
+  }
+  activity = (sum0 + sum1) + (sum2 + sum3);
+  normSquared = (norm0 + norm1) + (norm2 + norm3);
+}
+}
+
+void OsiCuts::computeViolations(const double *solution, double *violation,
+  double *efficacy) const
+{
+  int numberCuts = sizeRowCuts();
+  for (int i = 0; i < numberCuts; i++) {
+    RowCutView cut = rowCutView(i);
+    double activity;
+    double normSquared;
+    cutActivity(cut.numberElements, cut.indices, cut.elements, solution,
+      activity, normSquared);
+    double infeasibility;
+    if (activity > cut.ub)
+      infeasibility = activity - cut.ub;
+    else if (activity < cut.lb)
+      infeasibility = cut.lb - activity;
+    else
+      infeasibility = 0.0;
+    violation[i] = infeasibility;
+    if (efficacy)
+      efficacy[i] = normSquared > 0.0 ? infeasibility / sqrt(normSquared) : 0.0;
+  }
+}
+
+//-------------------------------------------------------------------
+// Choose a subset of row cuts by efficacy and parallelism
+//-------------------------------------------------------------------
+int OsiCuts::selectRowCuts(const double *solution, int maximumCuts,
+  double maximumParallelism, int *which, int numberCandidates,
+  double minimumEfficacy) const
+{
+  int i;
+  if (numberCandidates < 0) {
+    numberCandidates = sizeRowCuts();
+    for (i = 0; i < numberCandidates; i++)
+      which[i] = i;
+  }
+  if (maximumCuts <= 0 || !numberCandidates)
+    return 0;
+
+  /*
+    Score the candidates and keep the promising ones in a heap. Only the
+    cuts actually popped are ever ordered, so with k cuts wanted out of n
+    the cost is O(n + k log n) rather than a full sort. The index is
+    negated so that ties go to the cut inserted first.
+  */
+  std::vector< std::pair< double, int > > heap;
+  heap.reserve(numberCandidates);
+  std::vector< double > norm(numberCandidates);
+  int maximumIndex = -1;
+  for (i = 0; i < numberCandidates; i++) {
+    RowCutView cut = rowCutView(which[i]);
+    double activity;
+    double normSquared;
+    cutActivity(cut.numberElements, cut.indices, cut.elements, solution,
+      activity, normSquared);
+    double infeasibility = 0.0;
+    if (activity > cut.ub)
+      infeasibility = activity - cut.ub;
+    else if (activity < cut.lb)
+      infeasibility = cut.lb - activity;
+    if (normSquared <= 0.0)
+      continue;
+    norm[i] = sqrt(normSquared);
+    double efficacy = infeasibility / norm[i];
+    if (efficacy <= minimumEfficacy)
+      continue;
+    heap.push_back(std::pair< double, int >(efficacy, -i));
+    for (int j = 0; j < cut.numberElements; j++)
+      maximumIndex = CoinMax(maximumIndex, cut.indices[j]);
+  }
+  std::make_heap(heap.begin(), heap.end());
+
+  // chosen[k] is a position in which; dense holds the current candidate
+  std::vector< int > chosen;
+  chosen.reserve(CoinMin(maximumCuts, static_cast< int >(heap.size())));
+  std::vector< double > dense(maximumIndex + 1, 0.0);
+  while (!heap.empty() && static_cast< int >(chosen.size()) < maximumCuts) {
+    std::pop_heap(heap.begin(), heap.end());
+    int iCandidate = -heap.back().second;
+    heap.pop_back();
+    RowCutView cut = rowCutView(which[iCandidate]);
+    int j;
+    for (j = 0; j < cut.numberElements; j++)
+      dense[cut.indices[j]] = cut.elements[j];
+    bool parallel = false;
+    for (size_t k = 0; k < chosen.size(); k++) {
+      RowCutView other = rowCutView(which[chosen[k]]);
+      double product = 0.0;
+      for (j = 0; j < other.numberElements; j++)
+        product += other.elements[j] * dense[other.indices[j]];
+      if (fabs(product) > maximumParallelism * norm[iCandidate] * norm[chosen[k]]) {
+        parallel = true;
+        break;
+      }
+    }
+    for (j = 0; j < cut.numberElements; j++)
+      dense[cut.indices[j]] = 0.0;
+    if (!parallel)
+      chosen.push_back(iCandidate);
+  }
+
+  int numberChosen = static_cast< int >(chosen.size());
+  for (i = 0; i < numberChosen; i++)
+    chosen[i] = which[chosen[i]];
+  for (i = 0; i < numberChosen; i++)
+    which[i] = chosen[i];
+  return numberChosen;
+}
+
+//-------------------------------------------------------------------
+// Binary files
+//-------------------------------------------------------------------
+namespace {
+const char binaryMagic[8] = { 'O', 's', 'i', 'C', 'u', 't', 's', '\0' };
+const int binaryVersion = 1;
+const int binaryByteOrder = 0x01020304;
+
+// Writes to a FILE, remembering if anything went wrong
+class BinaryWriter {
+public:
+  BinaryWriter(FILE *fp)
+    : fp_(fp)
+    , ok_(true)
+  {
+  }
+  void write(const void *data, size_t bytes)
+  {
+    if (ok_ && bytes && fwrite(data, 1, bytes, fp_) != bytes)
+      ok_ = false;
+  }
+  void writeInt(int value) { write(&value, sizeof(int)); }
+  void writeDouble(double value) { write(&value, sizeof(double)); }
+  void writeVector(const CoinPackedVector &vector)
+  {
+    int n = vector.getNumElements();
+    writeInt(n);
+    write(vector.getIndices(), n * sizeof(int));
+    write(vector.getElements(), n * sizeof(double));
+  }
+  bool ok() const { return ok_; }
+
+private:
+  FILE *fp_;
+  bool ok_;
+};
+
+// Reads either from a FILE or from memory
+class BinaryReader {
+public:
+  BinaryReader(FILE *fp)
+    : fp_(fp)
+    , buffer_(NULL)
+    , left_(0)
+  {
+  }
+  BinaryReader(const void *buffer, size_t length)
+    : fp_(NULL)
+    , buffer_(static_cast< const char * >(buffer))
+    , left_(length)
+  {
+  }
+  bool read(void *data, size_t bytes)
+  {
+    if (!bytes)
+      return true;
+    if (fp_)
+      return fread(data, 1, bytes, fp_) == bytes;
+    if (bytes > left_)
+      return false;
+    memcpy(data, buffer_, bytes);
+    buffer_ += bytes;
+    left_ -= bytes;
+    return true;
+  }
+  bool readInt(int &value) { return read(&value, sizeof(int)); }
+  bool readDouble(double &value) { return read(&value, sizeof(double)); }
+  // a count which must be non negative and, in memory, must fit what is left
+  bool readCount(int &value, size_t bytesEach)
+  {
+    if (!readInt(value) || value < 0)
+      return false;
+    return fp_ || static_cast< size_t >(value) <= left_ / bytesEach;
+  }
+  bool readVector(std::vector< int > &indices, std::vector< double > &elements)
+  {
+    int n;
+    if (!readCount(n, sizeof(int) + sizeof(double)))
+      return false;
+    indices.resize(n);
+    elements.resize(n);
+    return !n
+      || (read(&indices[0], n * sizeof(int))
+        && read(&elements[0], n * sizeof(double)));
+  }
+
+private:
+  FILE *fp_;
+  const char *buffer_;
+  size_t left_;
+};
+
+int readCuts(OsiCuts &cuts, BinaryReader &reader)
+{
+  char magic[sizeof(binaryMagic)];
+  int version, byteOrder;
+  if (!reader.read(magic, sizeof(magic))
+    || memcmp(magic, binaryMagic, sizeof(magic))
+    || !reader.readInt(version) || version != binaryVersion
+    || !reader.readInt(byteOrder) || byteOrder != binaryByteOrder)
+    return 1;
+  int numberRowCuts, numberColCuts;
+  if (!reader.readCount(numberRowCuts, 1)
+    || !reader.readCount(numberColCuts, 1))
+    return 2;
+  std::vector< int > indices;
+  std::vector< double > elements;
+  int i;
+  for (i = 0; i < numberRowCuts; i++) {
+    int globallyValid;
+    double lb, ub, effectiveness;
+    if (!reader.readInt(globallyValid) || !reader.readDouble(lb)
+      || !reader.readDouble(ub) || !reader.readDouble(effectiveness)
+      || !reader.readVector(indices, elements))
+      return 2;
+    // the collection owns what it reads, so owned elsewhere (2) becomes 1
+    if (globallyValid == 2)
+      globallyValid = 1;
+    int n = static_cast< int >(indices.size());
+    const int *rowIndices = n ? &indices[0] : NULL;
+    const double *rowElements = n ? &elements[0] : NULL;
+    if (globallyValid == 0 || globallyValid == 1) {
+      cuts.emplaceRowCut(lb, ub, n, rowIndices, rowElements, effectiveness,
+        globallyValid != 0);
+    } else {
+      OsiRowCut *cut = new OsiRowCut();
+      if (n)
+        cut->setRow(n, rowIndices, rowElements, false);
+      cut->setLb(lb);
+      cut->setUb(ub);
+      cut->setEffectiveness(effectiveness);
+      cut->setGloballyValidAsInteger(globallyValid);
+      cuts.insert(cut);
+    }
+  }
+  std::vector< int > ubIndices;
+  std::vector< double > ubElements;
+  for (i = 0; i < numberColCuts; i++) {
+    int globallyValid;
+    double effectiveness;
+    if (!reader.readInt(globallyValid) || !reader.readDouble(effectiveness)
+      || !reader.readVector(indices, elements)
+      || !reader.readVector(ubIndices, ubElements))
+      return 2;
+    if (globallyValid == 2)
+      globallyValid = 1;
+    OsiColCut *cut = new OsiColCut();
+    int n = static_cast< int >(indices.size());
+    if (n)
+      cut->setLbs(n, &indices[0], &elements[0]);
+    n = static_cast< int >(ubIndices.size());
+    if (n)
+      cut->setUbs(n, &ubIndices[0], &ubElements[0]);
+    cut->setEffectiveness(effectiveness);
+    cut->setGloballyValidAsInteger(globallyValid);
+    cuts.insert(cut);
+  }
+  return 0;
+}
+}
+
+int OsiCuts::writeBinary(FILE *fp) const
+{
+  BinaryWriter writer(fp);
+  writer.write(binaryMagic, sizeof(binaryMagic));
+  writer.writeInt(binaryVersion);
+  writer.writeInt(binaryByteOrder);
+  int numberRowCuts = sizeRowCuts();
+  int numberColCuts = sizeColCuts();
+  writer.writeInt(numberRowCuts);
+  writer.writeInt(numberColCuts);
+  int i;
+  for (i = 0; i < numberRowCuts; i++) {
+    RowCutView cut = rowCutView(i);
+    writer.writeInt(cut.globallyValid);
+    writer.writeDouble(cut.lb);
+    writer.writeDouble(cut.ub);
+    writer.writeDouble(cut.effectiveness);
+    writer.writeInt(cut.numberElements);
+    writer.write(cut.indices, cut.numberElements * sizeof(int));
+    writer.write(cut.elements, cut.numberElements * sizeof(double));
+  }
+  for (i = 0; i < numberColCuts; i++) {
+    const OsiColCut &cut = *colCutPtrs_[i];
+    writer.writeInt(cut.globallyValidAsInteger());
+    writer.writeDouble(cut.effectiveness());
+    writer.writeVector(cut.lbs());
+    writer.writeVector(cut.ubs());
+  }
+  return writer.ok() ? 0 : 1;
+}
+
+int OsiCuts::writeBinary(const char *fileName) const
+{
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp)
+    return 1;
+  int returnCode = writeBinary(fp);
+  if (fclose(fp))
+    returnCode = 1;
+  return returnCode;
+}
+
+int OsiCuts::readBinary(FILE *fp)
+{
+  BinaryReader reader(fp);
+  return readCuts(*this, reader);
+}
+
+int OsiCuts::readBinary(const void *buffer, size_t length)
+{
+  BinaryReader reader(buffer, length);
+  return readCuts(*this, reader);
+}
+
+int OsiCuts::readBinary(const char *fileName)
+{
+#if !defined(_WIN32)
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0)
+    return -1;
+  struct stat status;
+  if (fstat(fd, &status)) {
+    close(fd);
+    return -1;
+  }
+  if (!status.st_size) {
+    close(fd);
+    return 1;
+  }
+  size_t length = static_cast< size_t >(status.st_size);
+  void *buffer = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (buffer != MAP_FAILED) {
+    int returnCode = readBinary(buffer, length);
+    munmap(buffer, length);
+    return returnCode;
+  }
+#endif
+  // no mapping, read it as a stream
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp)
+    return -1;
+  int returnCode = readBinary(fp);
+  fclose(fp);
+  return returnCode;
+}
+
+//-------------------------------------------------------------------
+// Hash index used to spot duplicate row cuts
+//-------------------------------------------------------------------
+void OsiCuts::updateRowCutIndex()
+{
+  int numberRowCuts = sizeRowCuts();
+  int numberIndexed = static_cast< int >(rowCutHashNext_.size());
+  int numberBuckets = static_cast< int >(rowCutHashHead_.size());
+  if (!numberBuckets || numberIndexed > numberRowCuts
+    || numberRowCuts > 2 * numberBuckets) {
+    // rebuild with room to grow
+    numberBuckets = CoinMax(1024, 4 * numberRowCuts);
+    rowCutHashHead_.assign(numberBuckets, -1);
+    rowCutHashNext_.clear();
+    rowCutHashBucket_.clear();
+    rowCutIndexChanged_.clear();
+    numberIndexed = 0;
+  }
+  // move cuts whose support was changed through rowCutPtr()
+  for (size_t k = 0; k < rowCutIndexChanged_.size(); k++) {
+    int i = rowCutIndexChanged_[k];
+    RowCutView cut = rowCutView(i);
+    int ipos = hashCutSupport(cut.numberElements, cut.indices, numberBuckets);
+    int oldPos = rowCutHashBucket_[i];
+    if (ipos == oldPos)
+      continue;
+    int *link = &rowCutHashHead_[oldPos];
+    while (*link != i)
+      link = &rowCutHashNext_[*link];
+    *link = rowCutHashNext_[i];
+    rowCutHashNext_[i] = rowCutHashHead_[ipos];
+    rowCutHashHead_[ipos] = i;
+    rowCutHashBucket_[i] = ipos;
+  }
+  rowCutIndexChanged_.clear();
+  rowCutHashNext_.resize(numberRowCuts);
+  rowCutHashBucket_.resize(numberRowCuts);
+  for (int i = numberIndexed; i < numberRowCuts; i++) {
+    RowCutView cut = rowCutView(i);
+    int ipos = hashCutSupport(cut.numberElements, cut.indices, numberBuckets);
+    rowCutHashNext_[i] = rowCutHashHead_[ipos];
+    rowCutHashHead_[ipos] = i;
+    rowCutHashBucket_[i] = ipos;
+  }
+}
+
+/* Only cuts with the same support can be the same so they are the only ones
+   looked at.  Elements are compared in stored order as in the old linear
+   scan, so an unsorted cut already in the collection is never matched. */
+template < class FltEq >
+int OsiCuts::findDuplicateRowCut(double newLb, double newUb,
+  int numberElements, const int *newIndices, const double *newElements,
+  const FltEq &treatAsSame)
+{
+  updateRowCutIndex();
+  int numberBuckets = static_cast< int >(rowCutHashHead_.size());
+  int ipos = hashCutSupport(numberElements, newIndices, numberBuckets);
+  for (int i = rowCutHashHead_[ipos]; i >= 0; i = rowCutHashNext_[i]) {
+    RowCutView cut = rowCutView(i);
+    if (cut.numberElements != numberElements)
       continue;
-    if (!treatAsSame(cutPtr->lb(), newLb))
+    if (!treatAsSame(cut.lb, newLb))
       continue;
-    if (!treatAsSame(cutPtr->ub(), newUb))
+    if (!treatAsSame(cut.ub, newUb))
       continue;
-    const CoinPackedVector *thisVector = &(cutPtr->row());
-    const int *indices = thisVector->getIndices();
-    const double *elements = thisVector->getElements();
+    const int *indices = cut.indices;
+    const double *elements = cut.elements;
     int j;
     for (j = 0; j < numberElements; j++) {
       if (indices[j] != newIndices[j])
@@ -310,20 +1191,162 @@ bool OsiCuts::insertIfNotDuplicate(OsiRowCut &rc, CoinAbsFltEq treatAsSame)
       if (!treatAsSame(elements[j], newElements[j]))
         break;
     }
+    if (j == numberElements)
+      return i;
+  }
+  return -1;
+}
+
+/* Coefficients are compared with the ratio of the first ones, which must
+   be positive, as a negative multiple would reverse the inequality. */
+int OsiCuts::findScaledRowCut(int numberElements, const int *newIndices,
+  const double *newElements, double tolerance, double &ratio)
+{
+  if (!numberElements)
+    return -1;
+  updateRowCutIndex();
+  int numberBuckets = static_cast< int >(rowCutHashHead_.size());
+  int ipos = hashCutSupport(numberElements, newIndices, numberBuckets);
+  for (int i = rowCutHashHead_[ipos]; i >= 0; i = rowCutHashNext_[i]) {
+    RowCutView cut = rowCutView(i);
+    if (cut.numberElements != numberElements)
+      continue;
+    const int *indices = cut.indices;
+    const double *elements = cut.elements;
+    if (indices[0] != newIndices[0] || !elements[0])
+      continue;
+    double thisRatio = newElements[0] / elements[0];
+    if (thisRatio <= 0.0)
+      continue;
+    int j;
+    for (j = 1; j < numberElements; j++) {
+      if (indices[j] != newIndices[j])
+        break;
+      double value = newElements[j];
+      if (fabs(value - thisRatio * elements[j]) > tolerance * fabs(value))
+        break;
+    }
     if (j == numberElements) {
-      notDuplicate = false;
-      break;
+      ratio = thisRatio;
+      return i;
     }
   }
-  if (notDuplicate) {
+  return -1;
+}
+
+/* Insert a row cut unless it is made redundant by one in the collection */
+bool OsiCuts::insertIfNotDominated(OsiRowCut &rc, double tolerance)
+{
+  CoinPackedVector vector = rc.row();
+  int numberElements = vector.getNumElements();
+  int *newIndices = vector.getIndices();
+  double *newElements = vector.getElements();
+  CoinSort_2(newIndices, newIndices + numberElements, newElements);
+  double ratio = 1.0;
+  int iCut = findScaledRowCut(numberElements, newIndices, newElements,
+    tolerance, ratio);
+  if (iCut < 0 && packedRowCuts_ && numberElements) {
+    /* A packed cut with +1/-1 coefficients is stored positive ones first
+       so a multiple of one may be in either order.  Try the other. */
+    double magnitude = fabs(newElements[0]);
+    int numberPositive = 0;
+    int j;
+    for (j = 0; j < numberElements; j++) {
+      if (fabs(newElements[j]) != magnitude)
+        break;
+      if (newElements[j] > 0.0)
+        numberPositive++;
+    }
+    if (j == numberElements && numberPositive && numberPositive < numberElements) {
+      std::vector< int > indices(numberElements);
+      std::vector< double > elements(numberElements);
+      int nPositive = 0;
+      int nNegative = numberPositive;
+      for (j = 0; j < numberElements; j++) {
+        int k = newElements[j] > 0.0 ? nPositive++ : nNegative++;
+        indices[k] = newIndices[j];
+        elements[k] = newElements[j];
+      }
+      iCut = findScaledRowCut(numberElements, &indices[0], &elements[0],
+        tolerance, ratio);
+    }
+  }
+  if (iCut >= 0) {
+    RowCutView cut = rowCutView(iCut);
+    // bounds of rc in terms of the cut found
+    double lb = rc.lb();
+    double ub = rc.ub();
+    if (lb > -COIN_DBL_MAX)
+      lb /= ratio;
+    if (ub < COIN_DBL_MAX)
+      ub /= ratio;
+    bool tighterLb = lb > cut.lb + tolerance * CoinMax(1.0, fabs(cut.lb));
+    bool tighterUb = ub < cut.ub - tolerance * CoinMax(1.0, fabs(cut.ub));
+    if (!tighterLb && !tighterUb)
+      return false;
+    // a local cut must not change a global one (1, or 2 if owned elsewhere)
+    if (rc.globallyValid() || cut.globallyValid == 0) {
+      lb = tighterLb ? lb : cut.lb;
+      ub = tighterUb ? ub : cut.ub;
+      double effectiveness = CoinMax(cut.effectiveness, rc.effectiveness());
+      OsiRowCut *cutPtr = rowCutPtrs_[iCut];
+      if (cutPtr) {
+        cutPtr->setLb(lb);
+        cutPtr->setUb(ub);
+        cutPtr->setEffectiveness(effectiveness);
+      } else {
+        rowCutLower_[iCut] = lb;
+        rowCutUpper_[iCut] = ub;
+        rowCutEffectiveness_[iCut] = effectiveness;
+      }
+      return false;
+    }
+  }
+  orderUnitCoefficients(numberElements, newIndices, newElements);
+  if (packedRowCuts_) {
+    appendPackedRowCut(rc.lb(), rc.ub(), numberElements, newIndices,
+      newElements, rc.effectiveness(), rc.globallyValid() ? 1 : 0);
+  } else {
     OsiRowCut *newCutPtr = new OsiRowCut();
-    newCutPtr->setLb(newLb);
-    newCutPtr->setUb(newUb);
+    newCutPtr->setLb(rc.lb());
+    newCutPtr->setUb(rc.ub());
     newCutPtr->setRow(vector);
     newCutPtr->setGloballyValid(rc.globallyValid());
     newCutPtr->setEffectiveness(rc.effectiveness());
     rowCutPtrs_.push_back(newCutPtr);
   }
+  return true;
+}
+
+/* Insert a row cut unless it is a duplicate (CoinAbsFltEq)
+       returns true if inserted */
+bool OsiCuts::insertIfNotDuplicate(OsiRowCut &rc, CoinAbsFltEq treatAsSame)
+{
+  double newLb = rc.lb();
+  double newUb = rc.ub();
+  CoinPackedVector vector = rc.row();
+  int numberElements = vector.getNumElements();
+  int *newIndices = vector.getIndices();
+  double *newElements = vector.getElements();
+  CoinSort_2(newIndices, newIndices + numberElements, newElements);
+  orderUnitCoefficients(numberElements, newIndices, newElements);
+  bool notDuplicate = (findDuplicateRowCut(newLb, newUb, numberElements,
+                         newIndices, newElements, treatAsSame)
+    < 0);
+  if (notDuplicate) {
+    if (packedRowCuts_) {
+      appendPackedRowCut(newLb, newUb, numberElements, newIndices, newElements,
+        rc.effectiveness(), rc.globallyValid() ? 1 : 0);
+    } else {
+      OsiRowCut *newCutPtr = new OsiRowCut();
+      newCutPtr->setLb(newLb);
+      newCutPtr->setUb(newUb);
+      newCutPtr->setRow(vector);
+      newCutPtr->setGloballyValid(rc.globallyValid());
+      newCutPtr->setEffectiveness(rc.effectiveness());
+      rowCutPtrs_.push_back(newCutPtr);
+    }
+  }
   return notDuplicate;
 }
 
@@ -337,40 +1360,23 @@ void OsiCuts::insertIfNotDuplicate(OsiRowCut &rc, CoinRelFltEq treatAsSame)
   int *newIndices = vector.getIndices();
   double *newElements = vector.getElements();
   CoinSort_2(newIndices, newIndices + numberElements, newElements);
-  bool notDuplicate = true;
-  int numberRowCuts = sizeRowCuts();
-  for (int i = 0; i < numberRowCuts; i++) {
-    const OsiRowCut *cutPtr = rowCutPtr(i);
-    if (cutPtr->row().getNumElements() != numberElements)
-      continue;
-    if (!treatAsSame(cutPtr->lb(), newLb))
-      continue;
-    if (!treatAsSame(cutPtr->ub(), newUb))
-      continue;
-    const CoinPackedVector *thisVector = &(cutPtr->row());
-    const int *indices = thisVector->getIndices();
-    const double *elements = thisVector->getElements();
-    int j;
-    for (j = 0; j < numberElements; j++) {
-      if (indices[j] != newIndices[j])
-        break;
-      if (!treatAsSame(elements[j], newElements[j]))
-        break;
-    }
-    if (j == numberElements) {
-      notDuplicate = false;
-      break;
+  orderUnitCoefficients(numberElements, newIndices, newElements);
+  if (findDuplicateRowCut(newLb, newUb, numberElements, newIndices,
+        newElements, treatAsSame)
+    < 0) {
+    if (packedRowCuts_) {
+      appendPackedRowCut(newLb, newUb, numberElements, newIndices, newElements,
+        rc.effectiveness(), rc.globallyValid() ? 1 : 0);
+    } else {
+      OsiRowCut *newCutPtr = new OsiRowCut();
+      newCutPtr->setLb(newLb);
+      newCutPtr->setUb(newUb);
+      newCutPtr->setRow(vector);
+      newCutPtr->setGloballyValid(rc.globallyValid());
+      newCutPtr->setEffectiveness(rc.effectiveness());
+      rowCutPtrs_.push_back(newCutPtr);
     }
   }
-  if (notDuplicate) {
-    OsiRowCut *newCutPtr = new OsiRowCut();
-    newCutPtr->setLb(newLb);
-    newCutPtr->setUb(newUb);
-    newCutPtr->setRow(vector);
-    newCutPtr->setGloballyValid(rc.globallyValid());
-    newCutPtr->setEffectiveness(rc.effectiveness());
-    rowCutPtrs_.push_back(newCutPtr);
-  }
 }
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
@@ -9,6 +9,8 @@
 
 #include <cmath>
 #include <cfloat>
+#include <cstdio>
+#include <typeinfo>
 #include "OsiConfig.h"
 #include "OsiCollections.hpp"
 #include "OsiRowCut.hpp"
@@ -131,6 +133,33 @@ public:
   };
   //@}
 
+  /**@name Row cut view */
+  //@{
+  /** Read-only view of the data of one row cut.
+
+      Obtained from rowCutView(). Works in both storage modes without
+      creating an OsiRowCut object. The pointers are valid until the
+      collection is changed.
+    */
+  class OSILIB_EXPORT RowCutView {
+  public:
+    /// Number of elements
+    int numberElements;
+    /// Column indices
+    const int *indices;
+    /// Coefficients
+    const double *elements;
+    /// Lower bound
+    double lb;
+    /// Upper bound
+    double ub;
+    /// Effectiveness
+    double effectiveness;
+    /// globallyValidAsInteger() of the cut
+    int globallyValid;
+  };
+  //@}
+
   //-------------------------------------------------------------------
   //
   // Cuts class definition begins here:
@@ -143,11 +172,43 @@ public:
   inline void insert(const OsiRowCut &rc);
   /** \brief Insert a row cut unless it is a duplicate - cut may get sorted.
        Duplicate is defined as CoinAbsFltEq says same
-       returns true if inserted */
+       returns true if inserted
+
+       Candidates are located through a hash index on the cut support, so
+       the check costs O(size of cut) rather than a scan of the collection.
+       A cut already here is only recognised as a duplicate if it is
+       stored in the order this method stores cuts: indices increasing,
+       except that with packed storage a cut with all coefficients +1 or
+       -1 has its +1 columns first and then its -1 columns, each group in
+       increasing order.
+
+       A cut changed in place is rehashed only if it was got from the
+       non-const rowCutPtr() or rowCut() since the last time the index was
+       used. Changes made through an iterator, or through a pointer or
+       reference kept from before an earlier insertIfNotDuplicate() or
+       insertIfNotDominated(), are not seen, and the index then finds the
+       cut under its old support and coefficients. */
   bool insertIfNotDuplicate(OsiRowCut &rc, CoinAbsFltEq treatAsSame = CoinAbsFltEq(1.0e-12));
   /** \brief Insert a row cut unless it is a duplicate - cut may get sorted.
-       Duplicate is defined as CoinRelFltEq says same*/
+       Duplicate is defined as CoinRelFltEq says same
+       (see the CoinAbsFltEq version for details) */
   void insertIfNotDuplicate(OsiRowCut &rc, CoinRelFltEq treatAsSame);
+  /** \brief Insert a row cut unless one already here makes it redundant
+       - cut may get sorted.
+
+       A cut already in the collection with the same support, and
+       coefficients a positive multiple of those of \p rc (to relative
+       \p tolerance), is compared after scaling. If its bounds are at least
+       as tight, \p rc is redundant and dropped. Otherwise the bounds of
+       \p rc are used to tighten that cut, which keeps its effectiveness
+       or takes that of \p rc if larger. A globally valid cut is only
+       tightened by a globally valid one; if \p rc is local it is inserted
+       instead. Returns true if \p rc was inserted as a new cut.
+
+       Uses the same hash index as insertIfNotDuplicate(), which is on the
+       support only, so scaled cuts are found as cheaply as duplicates.
+    */
+  bool insertIfNotDominated(OsiRowCut &rc, double tolerance = 1.0e-9);
   /** \brief Insert a column cut */
   inline void insert(const OsiColCut &cc);
 
@@ -167,8 +228,37 @@ public:
     inline void insert( OsiCut    * & cPtr  );
 #endif
 
-  /** \brief Insert a set of cuts */
-  inline void insert(const OsiCuts &cs);
+  /** \brief Build a row cut in the collection from its data
+
+      Saves building an OsiRowCut only to have insert() copy it. With
+      packed storage (see setPackedRowCuts()) the data is appended to the
+      shared arrays and no OsiRowCut is created at all.
+    */
+  inline void emplaceRowCut(double lb, double ub, int numberElements,
+    const int *indices, const double *elements,
+    double effectiveness = 0.0, bool globallyValid = false);
+  /** \brief Build a column cut in the collection from its bounds
+
+      Saves building an OsiColCut only to have insert() copy it.
+    */
+  inline void emplaceColCut(int numberLbs, const int *lbIndices,
+    const double *lbValues, int numberUbs, const int *ubIndices,
+    const double *ubValues, double effectiveness = 0.0,
+    bool globallyValid = false);
+
+  /** \brief Insert a set of cuts (the cuts of \p cs are copied) */
+  void insert(const OsiCuts &cs);
+
+  /** \brief Move all cuts of \p cs into this collection
+
+      Ownership of the cut objects is handed over, nothing is cloned, and
+      \p cs is left empty. If \p removeDuplicates is true a row cut the
+      same (CoinAbsFltEq(1.0e-12)) as one already here, including one
+      just moved, is deleted instead (or only dropped, if it is owned
+      elsewhere: globallyValidAsInteger() 2); such cuts may get sorted as
+      in insertIfNotDuplicate(). Returns the number of row cuts deleted.
+    */
+  int transfer(OsiCuts &cs, bool removeDuplicates = true);
 
   //@}
 
@@ -208,6 +298,19 @@ public:
   /// Get const reference to i'th column cut
   inline const OsiColCut &colCut(int i) const;
 
+  /** \brief Get data of i'th row cut
+
+      Unlike rowCutPtr() this never creates an OsiRowCut when packed
+      storage is in use.
+    */
+  RowCutView rowCutView(int i) const;
+  /** True if row cut i is an OsiRowCut object (always unless packed
+      storage is in use and the cut has not been asked for as one) */
+  inline bool rowCutIsObject(int i) const
+  {
+    return rowCutPtrs_[i] != NULL;
+  }
+
   /// Get const pointer to the most effective cut
   inline const OsiCut *mostEffectiveCutPtr() const;
   /// Get pointer to the most effective cut
@@ -226,7 +329,8 @@ public:
     
       Handy in case one wants to use CGL without managing cuts in one of
       the OSI containers. Client is ultimately responsible for deleting the
-      data structures holding the row cuts.
+      data structures holding the row cuts. Packed row cuts which were never
+      obtained as objects are simply discarded.
     */
   inline void dumpCuts();
   /*! \brief Selective delete and clear for row cuts.
@@ -239,6 +343,124 @@ public:
   inline void eraseAndDumpCuts(const std::vector< int > to_erase);
   //@}
 
+  /**@name Row cut storage
+
+     By default each row cut is a separate OsiRowCut object. With packed
+     storage the coefficients, bounds and effectiveness of cuts added with
+     insert(const OsiRowCut &) or insertIfNotDuplicate() are appended to
+     arrays shared by the whole collection, in the style of a row ordered
+     CoinPackedMatrix. This saves two or three allocations per cut and
+     keeps a cut round contiguous in memory.
+
+     rowCut() and rowCutPtr() still work. The first time a packed cut is
+     asked for that way an OsiRowCut is created from the packed data; from
+     then on that object is the cut, so changes made through it are seen
+     everywhere. Bulk users should prefer rowCutView(), which does not
+     create objects. Cuts of a class derived from OsiRowCut, and cuts
+     inserted by pointer, are always kept as objects.
+
+     If Osi is compiled with OpenMP, const rowCut() and rowCutPtr() may be
+     called from several threads at once: the object is created under a
+     lock, which is only taken for a cut not yet created. Without OpenMP
+     there is no lock, and only one thread may use them on a packed
+     collection. rowCutView() takes no lock, so threads sharing a packed
+     collection should either all use rowCutView() or all use rowCut();
+     mixing the two on a cut that has not yet been created is not safe.
+
+     Erasing cuts leaves their coefficients in the shared arrays until
+     more than half of those arrays is dead, when the rest are copied
+     into smaller ones; rowCutView() pointers do not survive an erase.
+
+     Packed cuts whose coefficients are all +1.0 or -1.0 (clique, cover
+     and set packing cuts, say) are stored as indices only: the columns
+     with +1.0 come first, then those with -1.0, and the split point is
+     all that is kept. rowCutView() of such a cut points into one shared
+     array of +1.0s followed by -1.0s, so users see ordinary
+     coefficients. Note that this changes the order of the indices of a
+     cut with mixed signs.
+  */
+  //@{
+  /** Switch packed storage of row cuts on or off.
+      Switching off creates objects for any cuts that are still packed. */
+  void setPackedRowCuts(bool yesNo);
+  /// True if row cuts are packed
+  inline bool packedRowCuts() const { return packedRowCuts_; }
+  /// Number of coefficients held in packed storage (including dead space)
+  inline int packedRowCutElements() const
+  {
+    return static_cast< int >(rowCutIndices_.size());
+  }
+  //@}
+
+  /**@name Evaluating row cuts */
+  //@{
+  /** \brief Violation of every row cut by \p solution
+
+      On return \c violation[i] is what rowCut(i).violated(solution) would
+      give, that is the distance of the row activity from [lb,ub]. If
+      \p efficacy is not NULL, \c efficacy[i] is the violation divided by
+      the euclidean norm of the cut (0.0 for an empty cut). Both arrays
+      must hold sizeRowCuts() entries.
+
+      Works from the packed data when packed storage is in use and does
+      not create any OsiRowCut objects. Each activity is summed in a four
+      way unrolled scalar loop; no threads are used.
+    */
+  void computeViolations(const double *solution, double *violation,
+    double *efficacy = NULL) const;
+  /** \brief Choose up to \p maximumCuts row cuts by efficacy and parallelism
+
+      Candidates are taken in order of decreasing efficacy with respect to
+      \p solution. A candidate is skipped if its efficacy is not above
+      \p minimumEfficacy, or if the absolute cosine of the angle between it
+      and a cut already chosen is above \p maximumParallelism. Only as
+      much of the candidate list is ordered as is needed to fill the
+      selection.
+
+      If \p numberCandidates is negative all row cuts are candidates,
+      otherwise \p which holds the indices of the candidates on input.
+      On return \p which holds the indices of the chosen cuts, best
+      first, and the number chosen is returned. \p which must have room
+      for sizeRowCuts() entries in the first case.
+    */
+  int selectRowCuts(const double *solution, int maximumCuts,
+    double maximumParallelism, int *which, int numberCandidates = -1,
+    double minimumEfficacy = 1.0e-6) const;
+  //@}
+
+  /**@name Binary files
+
+     A compact binary form of a collection, for passing cuts between
+     processes and for checkpoints. Row and column cuts are written with
+     their bounds, effectiveness and validity exactly as held, so reading
+     gives back the same collection, except that a cut owned elsewhere
+     (globallyValidAsInteger() 2) is read back as globally valid (1), as
+     the collection owns the cuts it reads. The file starts with a magic word,
+     a version and a byte order mark; integers are 32 bit and reals are
+     doubles, both in the byte order of the machine which wrote the file.
+
+     Reading appends to the collection and returns 0 on success, 1 if the
+     data is not an OsiCuts file of a version and byte order this code
+     can read, and 2 if it is truncated or corrupt (cuts read before the
+     problem was found are kept).
+  */
+  //@{
+  /// Write the collection to \p fp. Returns 0 on success, 1 on write error
+  int writeBinary(FILE *fp) const;
+  /// Write the collection to file \p fileName. Returns 0 on success
+  int writeBinary(const char *fileName) const;
+  /// Read cuts from \p fp, cut by cut
+  int readBinary(FILE *fp);
+  /// Read cuts from a block of memory holding a whole file
+  int readBinary(const void *buffer, size_t length);
+  /** Read cuts from file \p fileName.
+
+      The file is mapped into memory where that is available (returns -1
+      if the file can not be opened).
+    */
+  int readBinary(const char *fileName);
+  //@}
+
   /**@name Sorting collection */
   //@{
   /// Cuts with greatest effectiveness are first.
@@ -319,14 +541,101 @@ private:
   void gutsOfCopy(const OsiCuts &source);
   /// Delete internal data
   void gutsOfDestructor();
+  /** Find a row cut the same as the one given (indices sorted) according
+      to \p treatAsSame.  Returns its index or -1.  Brings the hash index
+      up to date first. */
+  template < class FltEq >
+  int findDuplicateRowCut(double lb, double ub, int numberElements,
+    const int *indices, const double *elements, const FltEq &treatAsSame);
+  /** Find a row cut with the given support whose coefficients times
+      \p ratio (set, positive) are the given ones. Returns its index or -1. */
+  int findScaledRowCut(int numberElements, const int *indices,
+    const double *elements, double tolerance, double &ratio);
+  /// Append a row cut to packed storage
+  void appendPackedRowCut(double lb, double ub, int numberElements,
+    const int *indices, const double *elements,
+    double effectiveness, int globallyValid);
+  /// Object for packed row cut i, created if it does not exist yet
+  OsiRowCut *unpackRowCut(int i) const;
+  /// Remove per cut packed data of row cut i
+  void erasePackedRowCut(int i);
+  /// Drop coefficients of erased packed row cuts
+  void compactPackedRowCuts();
+  /// sort() for packed storage
+  void sortPackedRowCuts();
+  /// Forget all packed data
+  void clearPackedRowCuts();
+  /** Number of +1.0 coefficients if all are +1.0 or -1.0, otherwise -1
+      (also -1 for an empty row) */
+  static int unitCoefficients(int numberElements, const double *elements);
+  /** Reorder a row the way a packed +1/-1 cut is stored (does nothing
+      unless packed storage is in use) */
+  void orderUnitCoefficients(int numberElements, int *indices,
+    double *elements) const;
+  /// Add row cuts not yet in the hash index, rehashing if it got too full
+  void updateRowCutIndex();
+  /// Forget hash index (row cuts were removed or reordered)
+  inline void invalidateRowCutIndex()
+  {
+    rowCutHashHead_.clear();
+    rowCutHashNext_.clear();
+    rowCutHashBucket_.clear();
+    rowCutIndexChanged_.clear();
+  }
+  /** Note that row cut \p i may be changed, so it has to be rehashed before
+      the index is next used */
+  inline void rowCutMayChange(int i)
+  {
+    if (i < static_cast< int >(rowCutHashNext_.size())) {
+      if (rowCutIndexChanged_.size() < rowCutHashNext_.size())
+        rowCutIndexChanged_.push_back(i);
+      else
+        invalidateRowCutIndex(); // cheaper to rebuild
+    }
+  }
   //@}
 
   /**@name Private member data */
   //@{
-  /// Vector of row cuts pointers
-  OsiVectorRowCutPtr rowCutPtrs_;
+  /** Vector of row cuts pointers.
+      With packed storage an entry is NULL until the cut is unpacked. */
+  mutable OsiVectorRowCutPtr rowCutPtrs_;
   /// Vector of column cuts pointers
   OsiVectorColCutPtr colCutPtrs_;
+  /** First row cut in each bucket of the duplicate hash index (-1 if none).
+      Empty if the index has not been built. */
+  std::vector< int > rowCutHashHead_;
+  /** Next row cut in same bucket (-1 if none).  The index covers the first
+      rowCutHashNext_.size() row cuts. */
+  std::vector< int > rowCutHashNext_;
+  /// Bucket each indexed row cut is in
+  std::vector< int > rowCutHashBucket_;
+  /// Indexed row cuts handed out by non-const rowCutPtr() (may repeat)
+  std::vector< int > rowCutIndexChanged_;
+  /// True if row cuts are packed
+  bool packedRowCuts_;
+  /** Packed storage, one entry per row cut (all empty unless packed).
+      Entries for cuts which exist as objects are ignored. */
+  std::vector< CoinBigIndex > rowCutStarts_;
+  /// Number of elements in each packed row cut
+  std::vector< int > rowCutLengths_;
+  /// Lower bound of each packed row cut
+  std::vector< double > rowCutLower_;
+  /// Upper bound of each packed row cut
+  std::vector< double > rowCutUpper_;
+  /// Effectiveness of each packed row cut
+  std::vector< double > rowCutEffectiveness_;
+  /// globallyValidAsInteger of each packed row cut
+  std::vector< int > rowCutGloballyValid_;
+  /// Column indices of all packed row cuts
+  std::vector< int > rowCutIndices_;
+  /// Coefficients of all packed row cuts
+  std::vector< double > rowCutElements_;
+  /** Start of each packed row cut in rowCutElements_, or for a cut with
+      +1/-1 coefficients -1 - (number of +1.0 coefficients) */
+  std::vector< CoinBigIndex > rowCutElementStarts_;
+  /// n times +1.0 then n times -1.0, the coefficients of +1/-1 cuts
+  std::vector< double > rowCutUnitElements_;
   //@}
 };
 
@@ -335,9 +644,22 @@ private:
 //-------------------------------------------------------------------
 void OsiCuts::insert(const OsiRowCut &rc)
 {
+  if (packedRowCuts_ && typeid(rc) == typeid(OsiRowCut)) {
+    const CoinPackedVector &row = rc.row();
+    appendPackedRowCut(rc.lb(), rc.ub(), row.getNumElements(),
+      row.getIndices(), row.getElements(),
+      rc.effectiveness(), rc.globallyValidAsInteger());
+    return;
+  }
   OsiRowCut *newCutPtr = rc.clone();
   //assert(dynamic_cast<OsiRowCut*>(newCutPtr) != NULL );
-  rowCutPtrs_.push_back(static_cast< OsiRowCut * >(newCutPtr));
+  if (packedRowCuts_) {
+    // derived class, kept as an object behind an empty packed entry
+    appendPackedRowCut(0.0, 0.0, 0, NULL, NULL, 0.0, 0);
+    rowCutPtrs_.back() = static_cast< OsiRowCut * >(newCutPtr);
+  } else {
+    rowCutPtrs_.push_back(static_cast< OsiRowCut * >(newCutPtr));
+  }
 }
 void OsiCuts::insert(const OsiColCut &cc)
 {
@@ -348,7 +670,13 @@ void OsiCuts::insert(const OsiColCut &cc)
 
 void OsiCuts::insert(OsiRowCut *&rcPtr)
 {
-  rowCutPtrs_.push_back(rcPtr);
+  if (packedRowCuts_) {
+    // empty packed entry, the object is the cut
+    appendPackedRowCut(0.0, 0.0, 0, NULL, NULL, 0.0, 0);
+    rowCutPtrs_.back() = rcPtr;
+  } else {
+    rowCutPtrs_.push_back(rcPtr);
+  }
   rcPtr = NULL;
 }
 void OsiCuts::insert(OsiColCut *&ccPtr)
@@ -356,6 +684,36 @@ void OsiCuts::insert(OsiColCut *&ccPtr)
   colCutPtrs_.push_back(ccPtr);
   ccPtr = NULL;
 }
+
+void OsiCuts::emplaceRowCut(double lb, double ub, int numberElements,
+  const int *indices, const double *elements,
+  double effectiveness, bool globallyValid)
+{
+  if (packedRowCuts_) {
+    appendPackedRowCut(lb, ub, numberElements, indices, elements,
+      effectiveness, globallyValid ? 1 : 0);
+    return;
+  }
+  OsiRowCut *newCutPtr = new OsiRowCut();
+  if (numberElements)
+    newCutPtr->setRow(numberElements, indices, elements, false);
+  newCutPtr->setLb(lb);
+  newCutPtr->setUb(ub);
+  newCutPtr->setEffectiveness(effectiveness);
+  newCutPtr->setGloballyValid(globallyValid);
+  rowCutPtrs_.push_back(newCutPtr);
+}
+void OsiCuts::emplaceColCut(int numberLbs, const int *lbIndices,
+  const double *lbValues, int numberUbs, const int *ubIndices,
+  const double *ubValues, double effectiveness, bool globallyValid)
+{
+  OsiColCut *newCutPtr = new OsiColCut();
+  newCutPtr->setLbs(numberLbs, lbIndices, lbValues);
+  newCutPtr->setUbs(numberUbs, ubIndices, ubValues);
+  newCutPtr->setEffectiveness(effectiveness);
+  newCutPtr->setGloballyValid(globallyValid);
+  colCutPtrs_.push_back(newCutPtr);
+}
 #if 0
 void OsiCuts::insert( OsiCut* & cPtr )
 {
@@ -373,27 +731,17 @@ void OsiCuts::insert( OsiCut* & cPtr )
 }
 #endif
 
-// LANNEZ SEBASTIEN added Thu May 25 01:22:51 EDT 2006
-void OsiCuts::insert(const OsiCuts &cs)
-{
-  for (OsiCuts::const_iterator it = cs.begin(); it != cs.end(); it++) {
-    const OsiRowCut *rCut = dynamic_cast< const OsiRowCut * >(*it);
-    const OsiColCut *cCut = dynamic_cast< const OsiColCut * >(*it);
-    assert(rCut || cCut);
-    if (rCut)
-      insert(*rCut);
-    else
-      insert(*cCut);
-  }
-}
-
 //-------------------------------------------------------------------
 // sort
 //-------------------------------------------------------------------
 void OsiCuts::sort()
 {
+  invalidateRowCutIndex();
   std::sort(colCutPtrs_.begin(), colCutPtrs_.end(), OsiCutCompare());
-  std::sort(rowCutPtrs_.begin(), rowCutPtrs_.end(), OsiCutCompare());
+  if (packedRowCuts_)
+    sortPackedRowCuts();
+  else
+    std::sort(rowCutPtrs_.begin(), rowCutPtrs_.end(), OsiCutCompare());
 }
 
 //-------------------------------------------------------------------
@@ -415,9 +763,18 @@ int OsiCuts::sizeCuts() const
 //----------------------------------------------------------------
 // Get i'th cut from the collection
 //----------------------------------------------------------------
-const OsiRowCut *OsiCuts::rowCutPtr(int i) const { return rowCutPtrs_[i]; }
+const OsiRowCut *OsiCuts::rowCutPtr(int i) const
+{
+  return packedRowCuts_ ? unpackRowCut(i) : rowCutPtrs_[i];
+}
 const OsiColCut *OsiCuts::colCutPtr(int i) const { return colCutPtrs_[i]; }
-OsiRowCut *OsiCuts::rowCutPtr(int i) { return rowCutPtrs_[i]; }
+// Caller may change the cut, so it is rehashed before the index is next used
+OsiRowCut *OsiCuts::rowCutPtr(int i)
+{
+  rowCutMayChange(i);
+  OsiRowCut *cut = rowCutPtrs_[i];
+  return cut ? cut : unpackRowCut(i);
+}
 OsiColCut *OsiCuts::colCutPtr(int i) { return colCutPtrs_[i]; }
 
 const OsiRowCut &OsiCuts::rowCut(int i) const { return *rowCutPtr(i); }
@@ -474,8 +831,11 @@ void OsiCuts::printCuts() const
 //----------------------------------------------------------------
 void OsiCuts::eraseRowCut(int i)
 {
+  invalidateRowCutIndex();
   delete rowCutPtrs_[i];
   rowCutPtrs_.erase(rowCutPtrs_.begin() + i);
+  if (packedRowCuts_)
+    erasePackedRowCut(i);
 }
 void OsiCuts::eraseColCut(int i)
 {
@@ -486,21 +846,28 @@ void OsiCuts::eraseColCut(int i)
 OsiRowCut *
 OsiCuts::rowCutPtrAndZap(int i)
 {
-  OsiRowCut *cut = rowCutPtrs_[i];
+  invalidateRowCutIndex();
+  OsiRowCut *cut = rowCutPtr(i);
   rowCutPtrs_[i] = NULL;
   rowCutPtrs_.erase(rowCutPtrs_.begin() + i);
+  if (packedRowCuts_)
+    erasePackedRowCut(i);
   return cut;
 }
 void OsiCuts::dumpCuts()
 {
+  invalidateRowCutIndex();
   rowCutPtrs_.clear();
+  clearPackedRowCuts();
 }
 void OsiCuts::eraseAndDumpCuts(const std::vector< int > to_erase)
 {
   for (unsigned i = 0; i < to_erase.size(); i++) {
     delete rowCutPtrs_[to_erase[i]];
   }
+  invalidateRowCutIndex();
   rowCutPtrs_.clear();
+  clearPackedRowCuts();
 }
 
 #endif
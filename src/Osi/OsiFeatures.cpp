@@ -389,12 +389,12 @@ void OsiFeatures::compute(double *features, OsiSolverInterface *solver) {
     unsigned int nRows = solver->getNumRows();
     const double *rhs = solver->getRightHandSide();
     const char *sense = solver->getRowSense();
-    const CoinPackedMatrix *cpmRow =  solver->getMatrixByRow();
+    const OsiMatrixView viewRow = solver->getMatrixViewByRow();
     for ( unsigned int row=0 ; (row<nRows) ; ++row ) {
-        const int nzRow = cpmRow->getVectorLengths()[row];
-        const CoinBigIndex *starts = cpmRow->getVectorStarts();
-        const int *ridx = cpmRow->getIndices() + starts[row];
-        const double *rcoef = cpmRow->getElements() + starts[row];
+        const int nzRow = viewRow.getVectorLengths()[row];
+        const CoinBigIndex *starts = viewRow.getVectorStarts();
+        const int *ridx = viewRow.getIndices() + starts[row];
+        const double *rcoef = viewRow.getElements() + starts[row];
 
         rowNzSumm.add(nzRow);
 
@@ -642,7 +642,7 @@ void OsiFeatures::compute(double *features, OsiSolverInterface *solver) {
     rowNzSumm.finish();
 
     // cols
-    const CoinPackedMatrix *cpmCol =  solver->getMatrixByCol();
+    const OsiMatrixView viewCol = solver->getMatrixViewByCol();
     const double *obj = solver->getObjCoefficients();
     const double *colLB = solver->getColLower();
     const double *colUB = solver->getColUpper();
@@ -668,12 +668,12 @@ void OsiFeatures::compute(double *features, OsiSolverInterface *solver) {
             }
         }
 
-        const int nzCol = cpmCol->getVectorLengths()[j];
+        const int nzCol = viewCol.getVectorLengths()[j];
 
         colNzSumm.add(nzCol);
-        //const CoinBigIndex *starts = cpmCol->getVectorStarts();
-        //const int *ridx = cpmCol->getIndices() + starts[j];
-        //const double *rcoef = cpmCol->getElements() + starts[j];
+        //const CoinBigIndex *starts = viewCol.getVectorStarts();
+        //const int *ridx = viewCol.getIndices() + starts[j];
+        //const double *rcoef = viewCol.getElements() + starts[j];
 
         if (nzCol <= 1024) {
             features[OFcolsLess1024Nz]++;
@@ -747,7 +747,7 @@ void OsiFeatures::compute(double *features, OsiSolverInterface *solver) {
     features[OFaMin] = aSumm.minV;
     features[OFaMax] = aSumm.maxV;
     features[OFaAvg] = aSumm.avg;
-    features[OFaStdDev] = std_dev( cpmRow->getElements(), aSumm.avg, solver->getNumElements() );
+    features[OFaStdDev] = std_dev( viewRow.getElements(), aSumm.avg, solver->getNumElements() );
     features[OFaRatioLSA] = aSumm.ratioLSA;
     features[OFaAllInt] = aSumm.allIntEl;
     features[OFaPercInt] = aSumm.percIntEl;
@@ -780,12 +780,12 @@ void OsiFeatures::compute(double *features, OsiSolverInterface *solver) {
     features[OFrowNzMin] = rowNzSumm.minV;
     features[OFrowNzMax] = rowNzSumm.maxV;
     features[OFrowNzAvg] = rowNzSumm.avg;
-    features[OFrowNzStdDev] = std_dev(cpmRow->getVectorLengths(), rowNzSumm.avg, solver->getNumRows() );
+    features[OFrowNzStdDev] = std_dev(viewRow.getVectorLengths(), rowNzSumm.avg, solver->getNumRows() );
 
     features[OFcolNzMin] = colNzSumm.minV;
     features[OFcolNzMax] = colNzSumm.maxV;
     features[OFcolNzAvg] = colNzSumm.avg;
-    features[OFcolNzStdDev] = std_dev(cpmCol->getVectorLengths(), colNzSumm.avg, solver->getNumCols() );
+    features[OFcolNzStdDev] = std_dev(viewCol.getVectorLengths(), colNzSumm.avg, solver->getNumCols() );
 
     double dnRows = solver->getNumRows();
     features[OFpercRowsLess4Nz] = (features[OFrowsLess4Nz] / dnRows)*100.0;
@@ -0,0 +1,220 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiMatrixView_H
+#define OsiMatrixView_H
+
+#include <cstddef>
+#include <vector>
+
+#include "CoinTypes.h"
+#include "CoinPackedMatrix.hpp"
+#include "OsiConfig.h"
+
+/** Read only view of a row or column ordered matrix
+
+  A view holds pointers to the starts, lengths, indices and elements of
+  a matrix kept somewhere else (by the solver or a CoinPackedMatrix), as
+  CoinPackedMatrix lays them out: vector \c i is
+  <code>getIndices()[getVectorStarts()[i] + k]</code> for \c k below
+  <code>getVectorLengths()[i]</code>.  Nothing is copied.
+
+  The pointers are valid until the matrix is next changed.  version()
+  says which state of the matrix was seen: a view with the same version
+  as OsiSolverInterface::matrixVersion() is still valid.  A version of
+  zero tells nothing.
+
+  See OsiSolverInterface::getMatrixViewByRow().
+*/
+class OsiMatrixView {
+public:
+  /**@name Queries */
+  //@{
+  /// True if column ordered
+  inline bool isColOrdered() const { return colOrdered_; }
+  /// Number of vectors (columns if column ordered)
+  inline int getMajorDim() const { return majorDim_; }
+  /// Length of the vectors (rows if column ordered)
+  inline int getMinorDim() const { return minorDim_; }
+  /// Start of each vector in getIndices() and getElements()
+  inline const CoinBigIndex *getVectorStarts() const { return starts_; }
+  /// Length of each vector
+  inline const int *getVectorLengths() const { return lengths_; }
+  /// Minor indices
+  inline const int *getIndices() const { return indices_; }
+  /// Elements
+  inline const double *getElements() const { return elements_; }
+  /// Length of vector \p i
+  inline int getVectorSize(int i) const { return lengths_[i]; }
+  /// Number of elements (gaps between vectors are not counted)
+  inline CoinBigIndex getNumElements() const
+  {
+    CoinBigIndex number = 0;
+    for (int i = 0; i < majorDim_; i++)
+      number += lengths_[i];
+    return number;
+  }
+  /// State of the matrix seen by this view (0 if not known)
+  inline unsigned int version() const { return version_; }
+  /// True if there is no matrix behind the view
+  inline bool isEmpty() const { return !starts_; }
+  //@}
+
+  /**@name Constructors */
+  //@{
+  /// Default constructor (empty view)
+  OsiMatrixView()
+    : colOrdered_(true)
+    , majorDim_(0)
+    , minorDim_(0)
+    , starts_(NULL)
+    , lengths_(NULL)
+    , indices_(NULL)
+    , elements_(NULL)
+    , version_(0)
+  {
+  }
+  /// View of arrays in CoinPackedMatrix layout
+  OsiMatrixView(bool colOrdered, int majorDim, int minorDim,
+    const CoinBigIndex *starts, const int *lengths, const int *indices,
+    const double *elements, unsigned int version = 0)
+    : colOrdered_(colOrdered)
+    , majorDim_(majorDim)
+    , minorDim_(minorDim)
+    , starts_(starts)
+    , lengths_(lengths)
+    , indices_(indices)
+    , elements_(elements)
+    , version_(version)
+  {
+  }
+  /// View of \p matrix (NULL gives an empty view)
+  explicit OsiMatrixView(const CoinPackedMatrix *matrix, unsigned int version = 0)
+    : colOrdered_(true)
+    , majorDim_(0)
+    , minorDim_(0)
+    , starts_(NULL)
+    , lengths_(NULL)
+    , indices_(NULL)
+    , elements_(NULL)
+    , version_(version)
+  {
+    if (matrix) {
+      colOrdered_ = matrix->isColOrdered();
+      majorDim_ = matrix->getMajorDim();
+      minorDim_ = matrix->getMinorDim();
+      starts_ = matrix->getVectorStarts();
+      lengths_ = matrix->getVectorLengths();
+      indices_ = matrix->getIndices();
+      elements_ = matrix->getElements();
+    }
+  }
+  //@}
+
+private:
+  ///@name Private member data
+  //@{
+  /// True if column ordered
+  bool colOrdered_;
+  /// Number of vectors
+  int majorDim_;
+  /// Length of the vectors
+  int minorDim_;
+  /// Vector starts
+  const CoinBigIndex *starts_;
+  /// Vector lengths
+  const int *lengths_;
+  /// Minor indices
+  const int *indices_;
+  /// Elements
+  const double *elements_;
+  /// State of the matrix seen
+  unsigned int version_;
+  //@}
+};
+
+/** Arrays behind an OsiMatrixView for a solver which keeps none of its own
+
+  A solver interface whose solver does not hold CoinPackedMatrix style
+  arrays keeps one of these per ordering and fills it when a view is
+  asked for.  invalidate() keeps the arrays, so filling them again after
+  the matrix changes only allocates if the matrix has grown.
+*/
+class OsiMatrixViewBuffer {
+public:
+  /// Default constructor (not filled)
+  OsiMatrixViewBuffer()
+    : colOrdered_(true)
+    , majorDim_(0)
+    , minorDim_(0)
+    , version_(0)
+    , filled_(false)
+  {
+  }
+  /// True if filled since invalidate()
+  inline bool isFilled() const { return filled_; }
+  /// Forget the contents (the arrays are kept)
+  inline void invalidate() { filled_ = false; }
+  /** Make room for \p majorDim vectors and \p numberElements elements.
+      One more element than asked for is always there, for solvers which
+      fill vectors from index 1. */
+  inline void reserve(int majorDim, CoinBigIndex numberElements)
+  {
+    starts_.resize(majorDim + 1);
+    lengths_.resize(majorDim + 1);
+    indices_.resize(numberElements + 1);
+    elements_.resize(numberElements + 1);
+  }
+  /// Vector starts to fill (after reserve())
+  inline CoinBigIndex *starts() { return &starts_[0]; }
+  /// Vector lengths to fill (after reserve())
+  inline int *lengths() { return &lengths_[0]; }
+  /// Minor indices to fill (after reserve())
+  inline int *indices() { return &indices_[0]; }
+  /// Elements to fill (after reserve())
+  inline double *elements() { return &elements_[0]; }
+  /// Say the arrays now hold a matrix of this shape
+  inline void setFilled(bool colOrdered, int majorDim, int minorDim,
+    unsigned int version)
+  {
+    colOrdered_ = colOrdered;
+    majorDim_ = majorDim;
+    minorDim_ = minorDim;
+    version_ = version;
+    filled_ = true;
+  }
+  /// View of the arrays (empty if not filled)
+  inline OsiMatrixView view() const
+  {
+    if (!filled_)
+      return OsiMatrixView();
+    return OsiMatrixView(colOrdered_, majorDim_, minorDim_, &starts_[0],
+      &lengths_[0], &indices_[0], &elements_[0], version_);
+  }
+
+private:
+  /// Vector starts
+  std::vector< CoinBigIndex > starts_;
+  /// Vector lengths
+  std::vector< int > lengths_;
+  /// Minor indices
+  std::vector< int > indices_;
+  /// Elements
+  std::vector< double > elements_;
+  /// True if column ordered
+  bool colOrdered_;
+  /// Number of vectors
+  int majorDim_;
+  /// Length of the vectors
+  int minorDim_;
+  /// State of the matrix held
+  unsigned int version_;
+  /// True if the arrays hold a matrix
+  bool filled_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -357,6 +357,21 @@ int hashCut (const OsiRowCut &x, int size)
     return hashValue%(size);
 }
 
+int hashCutSupport(const OsiRowCut &x, int size)
+{
+    return hashCutSupport(x.row().getNumElements(), x.row().getIndices(), size);
+}
+
+int hashCutSupport(int xN, const int *xIndices, int size)
+{
+    unsigned int hashValue = static_cast< unsigned int >(xN) * 2654435761u;
+    for (int j = 0; j < xN; j++) {
+        hashValue ^= static_cast< unsigned int >(xIndices[j]) + 0x9e3779b9u
+          + (hashValue << 6) + (hashValue >> 2);
+    }
+    return static_cast< int >(hashValue % static_cast< unsigned int >(size));
+}
+
 bool same(const OsiRowCut &x, const OsiRowCut &y)
 {
     int xN = x.row().getNumElements();
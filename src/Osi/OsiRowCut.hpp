@@ -209,6 +209,16 @@ private:
 OSILIB_EXPORT
 int hashCut(const OsiRowCut & x, int size);
 
+/** Hash on number of elements and column indices only.
+    Bounds and coefficients are left out so that cuts which are the same
+    within a tolerance land in the same bucket. */
+OSILIB_EXPORT
+int hashCutSupport(const OsiRowCut &x, int size);
+
+/// As above for a cut given by its column indices
+OSILIB_EXPORT
+int hashCutSupport(int numberElements, const int *indices, int size);
+
 OSILIB_EXPORT 
 bool same(const OsiRowCut &x, const OsiRowCut &y);
 
@@ -0,0 +1,224 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#pragma warning(disable : 4786)
+#endif
+
+#include <cassert>
+
+#include "CoinHelperFunctions.hpp"
+#include "OsiSharedPseudoCosts.hpp"
+#include "OsiChooseVariable.hpp"
+
+#if __cplusplus > 199711L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#include <atomic>
+#define OSI_SHAREDPSEUDOCOSTS_ATOMIC 1
+#endif
+
+//-------------------------------------------------------------------
+// Atomic values
+//-------------------------------------------------------------------
+namespace {
+#ifdef OSI_SHAREDPSEUDOCOSTS_ATOMIC
+typedef std::atomic< double > SharedDouble;
+typedef std::atomic< int > SharedInt;
+
+inline void addTo(SharedDouble &total, double value)
+{
+  double old = total.load();
+  while (!total.compare_exchange_weak(old, old + value)) {
+  }
+}
+inline void addTo(SharedInt &number, int value)
+{
+  number.fetch_add(value);
+}
+inline double get(const SharedDouble &total)
+{
+  return total.load();
+}
+inline int get(const SharedInt &number)
+{
+  return number.load();
+}
+#else
+// without OpenMP these are plain adds and loads (see class documentation)
+typedef double SharedDouble;
+typedef int SharedInt;
+
+inline void addTo(double &total, double value)
+{
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  total += value;
+}
+inline void addTo(int &number, int value)
+{
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  number += value;
+}
+inline double get(const double &total)
+{
+  double value;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+  value = total;
+  return value;
+}
+inline int get(const int &number)
+{
+  int value;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+  value = number;
+  return value;
+}
+#endif
+}
+
+struct OsiSharedPseudoCosts::Entry {
+  SharedDouble upTotalChange;
+  SharedDouble downTotalChange;
+  SharedInt upNumber;
+  SharedInt downNumber;
+  Entry()
+    : upTotalChange(0.0)
+    , downTotalChange(0.0)
+    , upNumber(0)
+    , downNumber(0)
+  {
+  }
+};
+
+//-------------------------------------------------------------------
+// Constructor and destructor
+//-------------------------------------------------------------------
+OsiSharedPseudoCosts::OsiSharedPseudoCosts(int numberObjects)
+  : entries_(NULL)
+  , numberObjects_(0)
+{
+  initialize(numberObjects);
+}
+
+OsiSharedPseudoCosts::~OsiSharedPseudoCosts()
+{
+  delete[] entries_;
+}
+
+void OsiSharedPseudoCosts::initialize(int n)
+{
+  delete[] entries_;
+  entries_ = NULL;
+  numberObjects_ = n > 0 ? n : 0;
+  if (numberObjects_)
+    entries_ = new Entry[numberObjects_];
+}
+
+//-------------------------------------------------------------------
+// Updating and reading
+//-------------------------------------------------------------------
+void OsiSharedPseudoCosts::updateInformation(int index, int branch,
+  double changeInObjective, double changeInValue, int status)
+{
+  assert(index >= 0 && index < numberObjects_);
+  assert(branch < 2);
+  assert(changeInValue > 0.0);
+  if (status == 1)
+    return;
+  assert(status >= 0);
+  Entry &entry = entries_[index];
+  if (branch) {
+    addTo(entry.upTotalChange, changeInObjective / changeInValue);
+    addTo(entry.upNumber, 1);
+  } else {
+    addTo(entry.downTotalChange, changeInObjective / changeInValue);
+    addTo(entry.downNumber, 1);
+  }
+}
+
+double OsiSharedPseudoCosts::upTotalChange(int i) const
+{
+  return get(entries_[i].upTotalChange);
+}
+
+double OsiSharedPseudoCosts::downTotalChange(int i) const
+{
+  return get(entries_[i].downTotalChange);
+}
+
+int OsiSharedPseudoCosts::upNumber(int i) const
+{
+  return get(entries_[i].upNumber);
+}
+
+int OsiSharedPseudoCosts::downNumber(int i) const
+{
+  return get(entries_[i].downNumber);
+}
+
+//-------------------------------------------------------------------
+// Snapshots
+//-------------------------------------------------------------------
+void OsiSharedPseudoCosts::snapshot(OsiPseudoCosts &pseudoCosts) const
+{
+  if (pseudoCosts.numberObjects() != numberObjects_) {
+    // initialize clears numberBeforeTrusted
+    int numberBeforeTrusted = pseudoCosts.numberBeforeTrusted();
+    pseudoCosts.initialize(numberObjects_);
+    pseudoCosts.setNumberBeforeTrusted(numberBeforeTrusted);
+  }
+  double *upTotal = pseudoCosts.upTotalChange();
+  double *downTotal = pseudoCosts.downTotalChange();
+  int *upNumber = pseudoCosts.upNumber();
+  int *downNumber = pseudoCosts.downNumber();
+  for (int i = 0; i < numberObjects_; i++) {
+    const Entry &entry = entries_[i];
+    upTotal[i] = get(entry.upTotalChange);
+    downTotal[i] = get(entry.downTotalChange);
+    upNumber[i] = get(entry.upNumber);
+    downNumber[i] = get(entry.downNumber);
+  }
+}
+
+void OsiSharedPseudoCosts::merge(const OsiPseudoCosts &pseudoCosts,
+  const OsiPseudoCosts *base)
+{
+  int number = CoinMin(pseudoCosts.numberObjects(), numberObjects_);
+  int numberBase = base ? CoinMin(base->numberObjects(), number) : 0;
+  const double *upTotal = pseudoCosts.upTotalChange();
+  const double *downTotal = pseudoCosts.downTotalChange();
+  const int *upNumber = pseudoCosts.upNumber();
+  const int *downNumber = pseudoCosts.downNumber();
+  for (int i = 0; i < number; i++) {
+    double upChange = upTotal[i];
+    double downChange = downTotal[i];
+    int upCount = upNumber[i];
+    int downCount = downNumber[i];
+    if (i < numberBase) {
+      upChange -= base->upTotalChange()[i];
+      downChange -= base->downTotalChange()[i];
+      upCount -= base->upNumber()[i];
+      downCount -= base->downNumber()[i];
+    }
+    Entry &entry = entries_[i];
+    if (upCount) {
+      addTo(entry.upTotalChange, upChange);
+      addTo(entry.upNumber, upCount);
+    }
+    if (downCount) {
+      addTo(entry.downTotalChange, downChange);
+      addTo(entry.downNumber, downCount);
+    }
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,116 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef OsiSharedPseudoCosts_H
+#define OsiSharedPseudoCosts_H
+
+#include <cstddef>
+
+#include "CoinPragma.hpp"
+#include "OsiConfig.h"
+
+class OsiPseudoCosts;
+
+/** Pseudo costs shared by several threads
+
+  OsiPseudoCosts belongs to one chooser and is updated without any
+  synchronization. OsiSharedPseudoCosts holds the same totals and counts
+  so that parallel tree search workers can learn from each other.
+
+  The data of each object (up and down totals and counts) is kept
+  together, so an update touches one place in memory. With C++11 or
+  OpenMP every update and read is atomic on its own, so
+  updateInformation() and the accessors may be called from any number of
+  threads. There is no lock.
+
+  A worker normally keeps its own OsiPseudoCosts for the chooser to read.
+  snapshot() copies the shared values into it, and merge() adds what the
+  worker learned since then. OsiChooseStrong::setSharedPseudoCosts() does
+  this at every node. A snapshot is not taken at one instant: objects
+  updated meanwhile may be seen before or after the update.
+
+  Atomicity comes from std::atomic with C++11, otherwise from OpenMP.
+  A C++98 build without OpenMP uses plain adds and loads, so there the
+  store is for one thread only.
+*/
+class OSILIB_EXPORT OsiSharedPseudoCosts {
+public:
+  /**@name Updating and reading (safe from many threads, see above) */
+  //@{
+  /** Given a branch fill in useful information.
+
+      As OsiPseudoCosts::updateInformation(int, int, double, double, int):
+      unless \p status is 1 (infeasible) the change per unit goes in the
+      up (\p branch 1) or down total and that count goes up.
+    */
+  void updateInformation(int whichObject, int branch,
+    double changeInObjective, double changeInValue, int status);
+  /// Total of all changes up for object \p i
+  double upTotalChange(int i) const;
+  /// Total of all changes down for object \p i
+  double downTotalChange(int i) const;
+  /// Number of times up for object \p i
+  int upNumber(int i) const;
+  /// Number of times down for object \p i
+  int downNumber(int i) const;
+  //@}
+
+  /**@name Snapshots */
+  //@{
+  /** Copy the shared values into \p pseudoCosts.
+
+      \p pseudoCosts is resized to numberObjects() if needed; its
+      numberBeforeTrusted() is kept.
+    */
+  void snapshot(OsiPseudoCosts &pseudoCosts) const;
+  /** Add what \p pseudoCosts learned since \p base.
+
+      For each object the totals and counts of \p pseudoCosts less those
+      of \p base are added to the shared values. With no \p base (or for
+      objects beyond its size) everything is added. Objects beyond
+      numberObjects() are ignored. Safe against concurrent updates.
+    */
+  void merge(const OsiPseudoCosts &pseudoCosts,
+    const OsiPseudoCosts *base = NULL);
+  //@}
+
+  /**@name Size (not to be called while other threads use the store) */
+  //@{
+  /// Initialize with \p n objects, all zero
+  void initialize(int n);
+  /// Number of objects
+  inline int numberObjects() const { return numberObjects_; }
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Constructor
+  OsiSharedPseudoCosts(int numberObjects = 0);
+
+  /// Destructor
+  ~OsiSharedPseudoCosts();
+  //@}
+
+private:
+  /// Not implemented
+  OsiSharedPseudoCosts(const OsiSharedPseudoCosts &);
+  /// Not implemented
+  OsiSharedPseudoCosts &operator=(const OsiSharedPseudoCosts &);
+
+  /// Data of one object, defined in the .cpp so the header is the same for all standards
+  struct Entry;
+
+  ///@name Private member data
+  //@{
+  /// One entry per object
+  Entry *entries_;
+  /// Number of objects
+  int numberObjects_;
+  //@}
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -4,6 +4,7 @@
 
 #include <stddef.h>
 #include <iostream>
+#include <algorithm>
 
 #include "CoinPragma.hpp"
 #include "CoinTime.hpp"
@@ -64,14 +65,22 @@ OsiSolverInterface::getFractionalIndices(const double etol) const
 {
   const int colnum = getNumCols();
   OsiVectorInt frac;
-  CoinAbsFltEq eq(etol);
+  OsiVectorInt integers;
   for (int i = 0; i < colnum; ++i) {
-    if (isInteger(i)) {
-      const double ci = getColSolution()[i];
-      const double distanceFromInteger = ci - floor(ci + 0.5);
-      if (!eq(distanceFromInteger, 0.0))
-        frac.push_back(i);
-    }
+    if (isInteger(i))
+      integers.push_back(i);
+  }
+  const int numberIntegers = static_cast< int >(integers.size());
+  if (!numberIntegers)
+    return frac;
+  // distances from integer all in one pass
+  std::vector< double > distanceFromInteger(numberIntegers);
+  OsiSimpleInteger::infeasibilities(numberIntegers, &integers[0],
+    getColSolution(), NULL, NULL, 0.0, &distanceFromInteger[0]);
+  CoinAbsFltEq eq(etol);
+  for (int i = 0; i < numberIntegers; ++i) {
+    if (!eq(distanceFromInteger[i], 0.0))
+      frac.push_back(integers[i]);
   }
   return frac;
 }
@@ -81,6 +90,34 @@ CoinBigIndex OsiSolverInterface::getNumElements() const
   return getMatrixByRow()->getNumElements();
 }
 
+void OsiSolverInterface::modelChanged()
+{
+  for (int i = 0; i < NumberModelParts; i++)
+    modelVersion_[i]++;
+}
+
+namespace {
+/* The parts the conflict graph is built from.  Versions only go up, so
+   their sum changes whenever any of them does. */
+unsigned int cgraphModelVersion(const OsiSolverInterface *solver)
+{
+  return solver->colBoundsVersion() + solver->rowBoundsVersion()
+    + solver->matrixVersion() + solver->integralityVersion();
+}
+}
+
+OsiMatrixView OsiSolverInterface::getMatrixViewByRow() const
+{
+  return OsiMatrixView(getMatrixByRow(),
+    tracksModelVersions() ? matrixVersion() : 0);
+}
+
+OsiMatrixView OsiSolverInterface::getMatrixViewByCol() const
+{
+  return OsiMatrixView(getMatrixByCol(),
+    tracksModelVersions() ? matrixVersion() : 0);
+}
+
 //#############################################################################
 // Methods for determining the type of column variable.
 // The method isContinuous() is presently implemented in the derived classes.
@@ -193,13 +230,23 @@ bool OsiSolverInterface::isFreeBinary(int colIndex) const
 const char *
 OsiSolverInterface::getColType(bool refresh) const
 {
-  if (!columnType_ || refresh) {
-    const int numCols = getNumCols();
-    if (!columnType_)
+  const int numCols = getNumCols();
+  // versions which never change say nothing, so only the size is checked
+  bool stale = tracksModelVersions() && columnTypeVersion_ != integralityVersion();
+  if (!columnType_ || refresh || stale || columnTypeSize_ != numCols) {
+    // semi-continuous types can only come from setColumnType(), so keep them
+    bool keepSemiContinuous = columnType_ && !refresh && columnTypeSize_ == numCols;
+    if (!columnType_ || columnTypeSize_ != numCols) {
+      delete[] columnType_;
       columnType_ = new char[numCols];
+      columnTypeSize_ = numCols;
+    }
+    columnTypeVersion_ = integralityVersion();
     const double *cu = getColUpper();
     const double *cl = getColLower();
     for (int i = 0; i < numCols; ++i) {
+      if (keepSemiContinuous && columnType_[i] >= 3)
+        continue;
       if (!isContinuous(i)) {
         if ((cu[i] == 1 || cu[i] == 0) && (cl[i] == 0 || cl[i] == 1))
           columnType_[i] = 1;
@@ -269,6 +316,262 @@ void OsiSolverInterface::setRowSetTypes(const int *indexFirst,
   }
 }
 //-----------------------------------------------------------------------------
+void OsiSolverInterface::beginModification()
+{
+  modificationDepth_++;
+}
+//-----------------------------------------------------------------------------
+/*
+  Kept changes are applied with modificationDepth_ zero, so the set calls
+  (and the single bound calls they make) change the solver.  A bound not
+  changed in the transaction is taken from the solver.
+*/
+void OsiSolverInterface::commitModification()
+{
+  assert(modificationDepth_ > 0);
+  if (modificationDepth_ <= 0 || --modificationDepth_)
+    return;
+  int number = static_cast< int >(columnBuffer_.indices.size());
+  if (number) {
+    const double *lower = getColLower();
+    const double *upper = getColUpper();
+    const int *indices = &columnBuffer_.indices[0];
+    double *bounds = &columnBuffer_.bounds[0];
+    for (int i = 0; i < number; i++) {
+      int iColumn = indices[i];
+      if (!(columnBuffer_.which[i] & 1))
+        bounds[2 * i] = lower[iColumn];
+      if (!(columnBuffer_.which[i] & 2))
+        bounds[2 * i + 1] = upper[iColumn];
+      columnBuffer_.position[iColumn] = -1;
+    }
+    setColSetBounds(indices, indices + number, bounds);
+  }
+  number = static_cast< int >(rowBuffer_.indices.size());
+  if (number) {
+    const double *lower = getRowLower();
+    const double *upper = getRowUpper();
+    const int *indices = &rowBuffer_.indices[0];
+    double *bounds = &rowBuffer_.bounds[0];
+    for (int i = 0; i < number; i++) {
+      int iRow = indices[i];
+      if (!(rowBuffer_.which[i] & 1))
+        bounds[2 * i] = lower[iRow];
+      if (!(rowBuffer_.which[i] & 2))
+        bounds[2 * i + 1] = upper[iRow];
+      rowBuffer_.position[iRow] = -1;
+    }
+    setRowSetBounds(indices, indices + number, bounds);
+  }
+  columnBuffer_.indices.clear();
+  columnBuffer_.bounds.clear();
+  columnBuffer_.which.clear();
+  rowBuffer_.indices.clear();
+  rowBuffer_.bounds.clear();
+  rowBuffer_.which.clear();
+}
+//-----------------------------------------------------------------------------
+bool OsiSolverInterface::bufferColBounds(int index, const double *lower,
+  const double *upper)
+{
+  if (modificationDepth_ <= 0)
+    return false;
+  bufferBounds(columnBuffer_, index, getNumCols(), lower, upper);
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OsiSolverInterface::bufferRowBounds(int index, const double *lower,
+  const double *upper)
+{
+  if (modificationDepth_ <= 0)
+    return false;
+  bufferBounds(rowBuffer_, index, getNumRows(), lower, upper);
+  return true;
+}
+//-----------------------------------------------------------------------------
+void OsiSolverInterface::bufferBounds(BoundBuffer &buffer, int index,
+  int number, const double *lower, const double *upper)
+{
+  assert(index >= 0 && index < number);
+  if (static_cast< int >(buffer.position.size()) < number)
+    buffer.position.resize(number, -1);
+  int i = buffer.position[index];
+  if (i < 0) {
+    i = static_cast< int >(buffer.indices.size());
+    buffer.position[index] = i;
+    buffer.indices.push_back(index);
+    buffer.bounds.push_back(0.0);
+    buffer.bounds.push_back(0.0);
+    buffer.which.push_back(0);
+  }
+  if (lower) {
+    buffer.bounds[2 * i] = *lower;
+    buffer.which[i] |= 1;
+  }
+  if (upper) {
+    buffer.bounds[2 * i + 1] = *upper;
+    buffer.which[i] |= 2;
+  }
+}
+//-----------------------------------------------------------------------------
+void OsiSolverInterface::clearModification()
+{
+  modificationDepth_ = 0;
+  columnBuffer_ = BoundBuffer();
+  rowBuffer_ = BoundBuffer();
+}
+//-----------------------------------------------------------------------------
+void OsiSolverInterface::pushNode(bool saveWarmStart)
+{
+  assert(!inModification());
+  nodeStack_.push_back(NodeLevel());
+  NodeLevel &level = nodeStack_.back();
+  level.trailStart = static_cast< int >(boundTrail_.size());
+  level.warmStart = saveWarmStart ? getWarmStart() : NULL;
+  level.copied = !tracksBoundChanges();
+  int numberColumns = getNumCols();
+  int numberRows = getNumRows();
+  level.numberRows = numberRows;
+  level.numberColumns = numberColumns;
+  if (level.copied) {
+    if (numberColumns) {
+      level.colLower.assign(getColLower(), getColLower() + numberColumns);
+      level.colUpper.assign(getColUpper(), getColUpper() + numberColumns);
+    }
+    if (numberRows) {
+      level.rowLower.assign(getRowLower(), getRowLower() + numberRows);
+      level.rowUpper.assign(getRowUpper(), getRowUpper() + numberRows);
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+/*
+  Bounds are put back in one transaction.  Undoing the trail backwards
+  leaves each bound as it was before its first change.
+*/
+void OsiSolverInterface::popNode()
+{
+  assert(!nodeStack_.empty());
+  assert(!inModification());
+  if (nodeStack_.empty())
+    return;
+  NodeLevel &level = nodeStack_.back();
+  undoingTrail_ = true;
+  beginModification();
+  if (level.copied) {
+    int numberColumns = CoinMin(getNumCols(), static_cast< int >(level.colLower.size()));
+    const double *lower = getColLower();
+    const double *upper = getColUpper();
+    int i;
+    for (i = 0; i < numberColumns; i++) {
+      if (lower[i] != level.colLower[i] || upper[i] != level.colUpper[i])
+        setColBounds(i, level.colLower[i], level.colUpper[i]);
+    }
+    int numberRows = CoinMin(getNumRows(), static_cast< int >(level.rowLower.size()));
+    lower = getRowLower();
+    upper = getRowUpper();
+    for (i = 0; i < numberRows; i++) {
+      if (lower[i] != level.rowLower[i] || upper[i] != level.rowUpper[i])
+        setRowBounds(i, level.rowLower[i], level.rowUpper[i]);
+    }
+  } else {
+    int numberColumns = getNumCols();
+    int numberRows = getNumRows();
+    for (int i = static_cast< int >(boundTrail_.size()) - 1; i >= level.trailStart; i--) {
+      const TrailEntry &entry = boundTrail_[i];
+      if (entry.index >= (entry.isRow ? numberRows : numberColumns))
+        continue; // deleted without trailRowsDeleted()
+      if (entry.isRow)
+        setRowBounds(entry.index, entry.lower, entry.upper);
+      else
+        setColBounds(entry.index, entry.lower, entry.upper);
+    }
+  }
+  commitModification();
+  undoingTrail_ = false;
+  boundTrail_.resize(level.trailStart);
+  if (level.warmStart) {
+    setWarmStart(level.warmStart);
+    delete level.warmStart;
+  }
+  nodeStack_.pop_back();
+}
+//-----------------------------------------------------------------------------
+void OsiSolverInterface::addToTrail(int index, bool isRow)
+{
+  const NodeLevel &level = nodeStack_.back();
+  if (index >= (isRow ? level.numberRows : level.numberColumns))
+    return; // added since the node was pushed
+  TrailEntry entry;
+  entry.index = index;
+  entry.isRow = isRow;
+  if (isRow) {
+    entry.lower = getRowLower()[index];
+    entry.upper = getRowUpper()[index];
+  } else {
+    entry.lower = getColLower()[index];
+    entry.upper = getColUpper()[index];
+  }
+  boundTrail_.push_back(entry);
+}
+//-----------------------------------------------------------------------------
+/*
+  An index goes down by the number deleted below it.  Entries for deleted
+  rows or columns go, so trailStart of each node is moved back by the
+  number dropped before it.
+*/
+void OsiSolverInterface::removeFromTrail(int num, const int *indices,
+  bool isRow)
+{
+  if (num <= 0)
+    return;
+  std::vector< int > deleted(indices, indices + num);
+  std::sort(deleted.begin(), deleted.end());
+  deleted.erase(std::unique(deleted.begin(), deleted.end()), deleted.end());
+  int numberEntries = static_cast< int >(boundTrail_.size());
+  // keptBefore[k] is number of entries kept among the first k
+  std::vector< int > keptBefore(numberEntries + 1);
+  int put = 0;
+  for (int k = 0; k < numberEntries; k++) {
+    keptBefore[k] = put;
+    TrailEntry entry = boundTrail_[k];
+    if (entry.isRow == isRow) {
+      std::vector< int >::const_iterator where = std::lower_bound(deleted.begin(), deleted.end(), entry.index);
+      if (where != deleted.end() && *where == entry.index)
+        continue;
+      entry.index -= static_cast< int >(where - deleted.begin());
+    }
+    boundTrail_[put++] = entry;
+  }
+  keptBefore[numberEntries] = put;
+  boundTrail_.resize(put);
+  for (size_t i = 0; i < nodeStack_.size(); i++) {
+    NodeLevel &level = nodeStack_[i];
+    level.trailStart = keptBefore[level.trailStart];
+    int &number = isRow ? level.numberRows : level.numberColumns;
+    number -= static_cast< int >(std::lower_bound(deleted.begin(), deleted.end(), number) - deleted.begin());
+    if (level.copied) {
+      std::vector< double > &lower = isRow ? level.rowLower : level.colLower;
+      std::vector< double > &upper = isRow ? level.rowUpper : level.colUpper;
+      for (int j = static_cast< int >(deleted.size()) - 1; j >= 0; j--) {
+        if (deleted[j] < static_cast< int >(lower.size())) {
+          lower.erase(lower.begin() + deleted[j]);
+          upper.erase(upper.begin() + deleted[j]);
+        }
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void OsiSolverInterface::clearNodeStack()
+{
+  for (size_t i = 0; i < nodeStack_.size(); i++)
+    delete nodeStack_[i].warmStart;
+  nodeStack_.clear();
+  boundTrail_.clear();
+  undoingTrail_ = false;
+}
+//-----------------------------------------------------------------------------
 void OsiSolverInterface::setContinuous(const int *indices, int len)
 {
   for (int i = 0; i < len; ++i) {
@@ -794,6 +1097,13 @@ double OsiSolverInterface::getObjValue() const
 
 OsiSolverInterface::ApplyCutsReturnCode
 OsiSolverInterface::applyCuts(const OsiCuts &cs, double effectivenessLb)
+{
+  return applyCuts(cs, -1, 1.0, effectivenessLb);
+}
+// As above but with selection of the best row cuts
+OsiSolverInterface::ApplyCutsReturnCode
+OsiSolverInterface::applyCuts(const OsiCuts &cs, int maximumRowCuts,
+  double maximumParallelism, double effectivenessLb)
 {
   OsiSolverInterface::ApplyCutsReturnCode retVal;
   int i;
@@ -820,48 +1130,184 @@ OsiSolverInterface::applyCuts(const OsiCuts &cs, double effectivenessLb)
     retVal.incrementApplied();
   }
 
-  // Loop once for each row cut
-  for (i = 0; i < cs.sizeRowCuts(); i++) {
-    if (cs.rowCut(i).effectiveness() < effectivenessLb) {
+  /*
+    Check all row cuts first, then add the ones accepted, with a single call
+    to addRows if the solver allows it so it only has to grow its row arrays
+    once. Cuts held as objects are checked with their own consistent() and
+    infeasible(); packed cuts get the same tests on OsiCuts::rowCutView so
+    they are not unpacked.
+  */
+  int numberRowCuts = cs.sizeRowCuts();
+  int numberColumns = getNumCols();
+  std::vector< int > which(numberRowCuts);
+  int numberAccepted = 0;
+  CoinBigIndex numberElements = 0;
+  // marks columns already seen in a packed cut
+  std::vector< int > mark;
+  for (i = 0; i < numberRowCuts; i++) {
+    OsiCuts::RowCutView cut = cs.rowCutView(i);
+    if (cut.effectiveness < effectivenessLb) {
       retVal.incrementIneffective();
       continue;
     }
-    if (!cs.rowCut(i).consistent()) {
-      retVal.incrementInternallyInconsistent();
-      continue;
-    }
-    if (!cs.rowCut(i).consistent(*this)) {
-      retVal.incrementExternallyInconsistent();
-      continue;
+    if (cs.rowCutIsObject(i)) {
+      // a derived class may have its own tests
+      const OsiRowCut &rc = cs.rowCut(i);
+      if (!rc.consistent()) {
+        retVal.incrementInternallyInconsistent();
+        continue;
+      }
+      if (!rc.consistent(*this)) {
+        retVal.incrementExternallyInconsistent();
+        continue;
+      }
+      if (rc.infeasible(*this)) {
+        retVal.incrementInfeasible();
+        continue;
+      }
+    } else {
+      // what OsiRowCut would test, without making the object
+      int minIndex = COIN_INT_MAX;
+      int maxIndex = -1;
+      for (int j = 0; j < cut.numberElements; j++) {
+        minIndex = CoinMin(minIndex, cut.indices[j]);
+        maxIndex = CoinMax(maxIndex, cut.indices[j]);
+      }
+      if (minIndex >= 0) {
+        if (maxIndex >= static_cast< int >(mark.size()))
+          mark.resize(CoinMax(maxIndex + 1, numberColumns), -1);
+        for (int j = 0; j < cut.numberElements; j++) {
+          int iColumn = cut.indices[j];
+          if (mark[iColumn] == i)
+            throw CoinError("Duplicate index found", "consistent", "OsiRowCut");
+          mark[iColumn] = i;
+        }
+      }
+      if (minIndex < 0) {
+        retVal.incrementInternallyInconsistent();
+        continue;
+      }
+      if (maxIndex >= numberColumns) {
+        retVal.incrementExternallyInconsistent();
+        continue;
+      }
+      if (cut.lb > cut.ub) {
+        retVal.incrementInfeasible();
+        continue;
+      }
     }
-    if (cs.rowCut(i).infeasible(*this)) {
-      retVal.incrementInfeasible();
-      continue;
+    which[numberAccepted++] = i;
+    numberElements += cut.numberElements;
+  }
+
+  // Only valid cuts are offered to the selection
+  const double *solution = getColSolution();
+  if (maximumRowCuts >= 0 && solution && numberAccepted) {
+    int numberSelected = cs.selectRowCuts(solution, maximumRowCuts,
+      maximumParallelism, &which[0], numberAccepted);
+    retVal.ineffective_ += numberAccepted - numberSelected;
+    numberAccepted = numberSelected;
+    // keep the original order of the cuts in the model
+    std::sort(which.begin(), which.begin() + numberAccepted);
+    numberElements = 0;
+    for (i = 0; i < numberAccepted; i++)
+      numberElements += cs.rowCutView(which[i]).numberElements;
+  }
+
+  retVal.applied_ += numberAccepted;
+  if (!applyRowCutsWithAddRows()) {
+    // the solver's own applyRowCut(), one cut at a time
+    for (i = 0; i < numberAccepted; i++) {
+      if (cs.rowCutIsObject(which[i])) {
+        applyRowCut(cs.rowCut(which[i]));
+      } else {
+        OsiCuts::RowCutView cut = cs.rowCutView(which[i]);
+        OsiRowCut rc;
+        rc.setRow(cut.numberElements, cut.indices, cut.elements, false);
+        rc.setLb(cut.lb);
+        rc.setUb(cut.ub);
+        rc.setEffectiveness(cut.effectiveness);
+        rc.setGloballyValidAsInteger(cut.globallyValid);
+        applyRowCut(rc);
+      }
     }
-    applyRowCut(cs.rowCut(i));
-    retVal.incrementApplied();
+  } else if (numberAccepted) {
+    CoinBigIndex *starts = new CoinBigIndex[numberAccepted + 1];
+    int *indices = new int[numberElements];
+    double *elements = new double[numberElements];
+    double *lower = new double[numberAccepted];
+    double *upper = new double[numberAccepted];
+    numberElements = 0;
+    starts[0] = 0;
+    for (i = 0; i < numberAccepted; i++) {
+      OsiCuts::RowCutView cut = cs.rowCutView(which[i]);
+      CoinMemcpyN(cut.indices, cut.numberElements, indices + numberElements);
+      CoinMemcpyN(cut.elements, cut.numberElements, elements + numberElements);
+      numberElements += cut.numberElements;
+      starts[i + 1] = numberElements;
+      lower[i] = cut.lb;
+      upper[i] = cut.ub;
+    }
+    addRows(numberAccepted, starts, indices, elements, lower, upper);
+    delete[] starts;
+    delete[] indices;
+    delete[] elements;
+    delete[] lower;
+    delete[] upper;
   }
 
   return retVal;
 }
 /* Apply a collection of row cuts which are all effective.
-   applyCuts seems to do one at a time which seems inefficient.
-   The default does slowly, but solvers can override.
+   If applyRowCutsWithAddRows() the cuts are gathered into one block and
+   added with a single call to addRows, else applyRowCut is called for each.
+   Solvers can override.
 */
 void OsiSolverInterface::applyRowCuts(int numberCuts, const OsiRowCut *cuts)
 {
-  int i;
-  for (i = 0; i < numberCuts; i++) {
-    applyRowCut(cuts[i]);
-  }
+  const OsiRowCut **cutPtrs = new const OsiRowCut *[numberCuts];
+  for (int i = 0; i < numberCuts; i++)
+    cutPtrs[i] = cuts + i;
+  applyRowCuts(numberCuts, cutPtrs);
+  delete[] cutPtrs;
 }
 // And alternatively
 void OsiSolverInterface::applyRowCuts(int numberCuts, const OsiRowCut **cuts)
 {
+  if (numberCuts <= 0)
+    return;
   int i;
-  for (i = 0; i < numberCuts; i++) {
-    applyRowCut(*cuts[i]);
+  if (!applyRowCutsWithAddRows()) {
+    for (i = 0; i < numberCuts; i++)
+      applyRowCut(*cuts[i]);
+    return;
   }
+  CoinBigIndex numberElements = 0;
+  for (i = 0; i < numberCuts; i++)
+    numberElements += cuts[i]->row().getNumElements();
+  CoinBigIndex *starts = new CoinBigIndex[numberCuts + 1];
+  int *indices = new int[numberElements];
+  double *elements = new double[numberElements];
+  double *lower = new double[numberCuts];
+  double *upper = new double[numberCuts];
+  numberElements = 0;
+  starts[0] = 0;
+  for (i = 0; i < numberCuts; i++) {
+    const CoinPackedVector &row = cuts[i]->row();
+    int number = row.getNumElements();
+    CoinMemcpyN(row.getIndices(), number, indices + numberElements);
+    CoinMemcpyN(row.getElements(), number, elements + numberElements);
+    numberElements += number;
+    starts[i + 1] = numberElements;
+    lower[i] = cuts[i]->lb();
+    upper[i] = cuts[i]->ub();
+  }
+  addRows(numberCuts, starts, indices, elements, lower, upper);
+  delete[] starts;
+  delete[] indices;
+  delete[] elements;
+  delete[] lower;
+  delete[] upper;
 }
 //#############################################################################
 // Set/Get Application Data
@@ -958,10 +1404,17 @@ OsiSolverInterface::OsiSolverInterface()
   , handler_(NULL)
   , defaultHandler_(true)
   , columnType_(NULL)
+  , columnTypeVersion_(0)
+  , columnTypeSize_(0)
   , appDataEtc_(NULL)
   , ws_(NULL)
   , cgraph_(NULL)
+  , cgraphVersion_(0)
+  , modificationDepth_(0)
+  , undoingTrail_(false)
 {
+  for (int i = 0; i < NumberModelParts; i++)
+    modelVersion_[i] = 1;
   setInitialData();
 }
 // Set data for default constructor
@@ -1017,6 +1470,9 @@ void OsiSolverInterface::setInitialData()
   	delete cgraph_;
   	cgraph_ = NULL;
   }
+
+  clearModification();
+  clearNodeStack();
 }
 
 //-------------------------------------------------------------------
@@ -1025,7 +1481,11 @@ void OsiSolverInterface::setInitialData()
 OsiSolverInterface::OsiSolverInterface(const OsiSolverInterface &rhs)
   : rowCutDebugger_(NULL)
   , ws_(NULL)
+  , modificationDepth_(0)
+  , undoingTrail_(false)
 {
+  // same model so same versions
+  CoinDisjointCopyN(rhs.modelVersion_, NumberModelParts, modelVersion_);
   appDataEtc_ = rhs.appDataEtc_->clone();
   if (rhs.rowCutDebugger_ != NULL)
     rowCutDebugger_ = new OsiRowCutDebugger(*rhs.rowCutDebugger_);
@@ -1057,12 +1517,15 @@ OsiSolverInterface::OsiSolverInterface(const OsiSolverInterface &rhs)
   objName_ = rhs.objName_;
   // NULL as number of columns not known
   columnType_ = NULL;
+  columnTypeVersion_ = 0;
+  columnTypeSize_ = 0;
 
   if (rhs.cgraph_) {
     cgraph_ = rhs.cgraph_->clone();
   } else {
     cgraph_ = NULL;
   }
+  cgraphVersion_ = rhs.cgraphVersion_;
 }
 
 //-------------------------------------------------------------------
@@ -1089,6 +1552,7 @@ OsiSolverInterface::~OsiSolverInterface()
     delete cgraph_;
     cgraph_ = NULL;
   }
+  clearNodeStack();
 }
 
 //----------------------------------------------------------------
@@ -1149,11 +1613,19 @@ OsiSolverInterface::operator=(const OsiSolverInterface &rhs)
       cgraph_ = NULL;
     }
 
+    // a new model, so versions go past those of both
+    bool cgraphValid = rhs.cgraph_ && rhs.cgraphVersion_ == cgraphModelVersion(&rhs);
+    for (i = 0; i < NumberModelParts; i++)
+      modelVersion_[i] = CoinMax(modelVersion_[i], rhs.modelVersion_[i]) + 1;
     if (rhs.cgraph_) {
       cgraph_ = rhs.cgraph_->clone();
     } else {
       cgraph_ = NULL;
     }
+    cgraphVersion_ = cgraphValid ? cgraphModelVersion(this) : 0;
+    // a transaction or node stack is not copied
+    clearModification();
+    clearNodeStack();
   }
   return *this;
 }
@@ -2334,7 +2806,7 @@ OsiSolverInterface::tightPrimalBounds(double * newRowLower,
   const double *objective = getObjCoefficients();
 #endif
   double direction = getObjSense();
-  const int *columnLength = getMatrixByCol()->getVectorLengths();
+  const int *columnLength = getMatrixViewByCol().getVectorLengths();
 
   int iRow, iColumn;
 
@@ -2997,40 +3469,37 @@ OsiSolverInterface::getSizeU() const
 }
 #endif
 #ifdef CBC_NEXT_VERSION
-/*
-  Solve 2**N (N==depth) problems and return solutions and bases.
-  There are N branches each of which changes bounds on both sides
-  as given by branch.  The user should provide an array of (empty)
-  results which will be filled in.  See OsiSolveResult for more details
-  (in OsiSolveBranch.?pp) but it will include a basis and primal solution.
-  
-  The order of results is left to right at feasible leaf nodes so first one
-  is down, down, .....
-  
-  Returns number of feasible leaves.  Also sets number of solves done and number
-  of iterations.
-  
-  This is provided so a solver can do faster.
-  
-  If forceBranch true then branch done even if satisfied
-*/
-int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
-  OsiSolverResult *result,
-  int &numberSolves, int &numberIterations,
-  bool forceBranch)
-{
-  int *stack = new int[depth];
-  CoinWarmStart **basis = new CoinWarmStart *[depth];
+namespace {
+/* A feasible node at which a parallel solveBranches() splits the tree.
+   The solver is a clone with the bounds of the node; iterated says if
+   anything was solved on the way down since the last backtrack. */
+struct BranchSubtree {
+  OsiSolverInterface *solver;
+  bool iterated;
+};
+
+/* Go through levels firstDepth to lastDepth-1 of the branches, starting
+   from the current state of solver.  Each level is a pushNode(), so
+   moving from one leaf to the next only undoes and applies the bounds
+   that differ.  If lastDepth is depth, feasible leaves go in result and
+   their number is returned; otherwise a clone of each feasible node at
+   lastDepth is added to subtrees.  Solves and iterations are added to
+   numberSolves and numberIterations.  The bounds are put back at the end. */
+int enumerateBranches(OsiSolverInterface &solver, int firstDepth, int lastDepth,
+  int depth, const OsiSolverBranch *branch, bool forceBranch, bool iterated,
+  const double *lowerBefore, const double *upperBefore,
+  OsiSolverResult *result, std::vector< BranchSubtree > &subtrees,
+  int &numberSolves, int &numberIterations)
+{
+  assert(firstDepth < lastDepth && lastDepth <= depth);
+  int startNode = solver.nodeDepth();
+  std::vector< int > stack(depth, -1);
   int iDepth;
-  for (iDepth = 0; iDepth < depth; iDepth++) {
-    stack[iDepth] = -1;
-    basis[iDepth] = NULL;
-  }
   //#define PRINTALL
 #ifdef PRINTALL
   int seq[10];
   double val[10];
-  assert(iDepth <= 10);
+  assert(depth <= 10);
   for (iDepth = 0; iDepth < depth; iDepth++) {
     assert(branch[iDepth].starts()[4] == 2);
     assert(branch[iDepth].which()[0] == branch[iDepth].which()[1]);
@@ -3040,56 +3509,40 @@ int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
     printf("depth %d seq %d nominal value %g\n", iDepth, seq[iDepth], val[iDepth] + 0.5);
   }
 #endif
-  int numberColumns = getNumCols();
-  double *lowerBefore = CoinCopyOfArray(getColLower(), numberColumns);
-  double *upperBefore = CoinCopyOfArray(getColUpper(), numberColumns);
-  iDepth = 0;
+  iDepth = firstDepth;
   int numberFeasible = 0;
   bool finished = false;
   bool backTrack = false;
-  bool iterated = false;
-  numberIterations = 0;
-  numberSolves = 0;
-  int nFeas = 0;
   while (!finished) {
     bool feasible = true;
-    if (stack[iDepth] == -1) {
-      delete basis[iDepth];
-      basis[iDepth] = getWarmStart();
-    } else {
-      setWarmStart(basis[iDepth]);
-    }
-    // may be a faster way
-    setColLower(lowerBefore);
-    setColUpper(upperBefore);
-    for (int i = 0; i < iDepth; i++) {
-      // skip if values feasible and not forceBranch
-      if (stack[i])
-        branch[i].applyBounds(*this, stack[i]);
+    if (stack[iDepth] != -1) {
+      // other way - back to bounds and basis before this level
+      solver.popNode();
     }
+    solver.pushNode(true);
     bool doBranch = true;
     if (!forceBranch && !backTrack) {
       // see if feasible on one side
-      if (!branch[iDepth].feasibleOneWay(*this)) {
-        branch[iDepth].applyBounds(*this, stack[iDepth]);
+      if (!branch[iDepth].feasibleOneWay(solver)) {
+        branch[iDepth].applyBounds(solver, stack[iDepth]);
       } else {
         doBranch = false;
         stack[iDepth] = 0;
       }
     } else {
-      branch[iDepth].applyBounds(*this, stack[iDepth]);
+      branch[iDepth].applyBounds(solver, stack[iDepth]);
     }
     if (doBranch) {
-      resolve();
-      numberIterations += getIterationCount();
+      solver.resolve();
+      numberIterations += solver.getIterationCount();
       numberSolves++;
       iterated = true;
-      if (!isProvenOptimal() || isDualObjectiveLimitReached()) {
+      if (!solver.isProvenOptimal() || solver.isDualObjectiveLimitReached()) {
         feasible = false;
 #ifdef PRINTALL
-        const double *columnLower = getColLower();
-        const double *columnUpper = getColUpper();
-        const double *columnSolution = getColSolution();
+        const double *columnLower = solver.getColLower();
+        const double *columnUpper = solver.getColUpper();
+        const double *columnSolution = solver.getColSolution();
         printf("infeas depth %d ", iDepth);
         for (int jDepth = 0; jDepth <= iDepth; jDepth++) {
           int iColumn = seq[jDepth];
@@ -3101,11 +3554,10 @@ int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
       }
     } else {
       // must be feasible
-      nFeas++;
 #ifdef PRINTALL
-      const double *columnLower = getColLower();
-      const double *columnUpper = getColUpper();
-      const double *columnSolution = getColSolution();
+      const double *columnLower = solver.getColLower();
+      const double *columnUpper = solver.getColUpper();
+      const double *columnSolution = solver.getColSolution();
       printf("feas depth %d ", iDepth);
       int iColumn = seq[iDepth];
       printf(" (%d %g, %g, %g (nom %g))", iColumn, columnLower[iColumn],
@@ -3115,33 +3567,50 @@ int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
     }
     backTrack = false;
     iDepth++;
-    if (iDepth == depth || !feasible) {
-      if (feasible && iterated) {
-        result[numberFeasible++] = OsiSolverResult(*this, lowerBefore, upperBefore);
+    if (iDepth == lastDepth || !feasible) {
+      if (feasible) {
+        if (lastDepth == depth) {
+          if (iterated) {
+            result[numberFeasible++] = OsiSolverResult(solver, lowerBefore, upperBefore);
 #ifdef PRINTALL
-        const double *columnLower = getColLower();
-        const double *columnUpper = getColUpper();
-        const double *columnSolution = getColSolution();
-        printf("sol obj %g", getObjValue());
-        for (int jDepth = 0; jDepth < depth; jDepth++) {
-          int iColumn = seq[jDepth];
-          printf(" (%d %g, %g, %g (nom %g))", iColumn, columnLower[iColumn],
-            columnSolution[iColumn], columnUpper[iColumn], val[jDepth] + 0.5);
-        }
-        printf("\n");
+            const double *columnLower = solver.getColLower();
+            const double *columnUpper = solver.getColUpper();
+            const double *columnSolution = solver.getColSolution();
+            printf("sol obj %g", solver.getObjValue());
+            for (int jDepth = 0; jDepth < depth; jDepth++) {
+              int iColumn = seq[jDepth];
+              printf(" (%d %g, %g, %g (nom %g))", iColumn, columnLower[iColumn],
+                columnSolution[iColumn], columnUpper[iColumn], val[jDepth] + 0.5);
+            }
+            printf("\n");
 #endif
+          }
+        } else {
+          /* The clone gets the optimal basis and solution of the node
+             so the subtree can start without solving it again. */
+          BranchSubtree subtree;
+          subtree.solver = solver.clone();
+          CoinWarmStart *warmStart = solver.getWarmStart();
+          subtree.solver->setWarmStart(warmStart);
+          delete warmStart;
+          subtree.solver->setColSolution(solver.getColSolution());
+          subtree.solver->setRowPrice(solver.getRowPrice());
+          subtree.iterated = iterated;
+          subtrees.push_back(subtree);
+        }
       }
       // on to next
       iDepth--;
       iterated = false;
       backTrack = true;
       while (stack[iDepth] >= 0) {
-        if (iDepth == 0) {
+        if (iDepth == firstDepth) {
           // finished
           finished = true;
           break;
         }
         stack[iDepth] = -1;
+        solver.popNode();
         iDepth--;
       }
       if (!finished) {
@@ -3149,31 +3618,112 @@ int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
       }
     }
   }
-  delete[] stack;
-  for (iDepth = 0; iDepth < depth; iDepth++)
-    delete basis[iDepth];
-  delete[] basis;
-  // restore bounds
-  setColLower(lowerBefore);
-  setColUpper(upperBefore);
+  // restore bounds and basis
+  while (solver.nodeDepth() > startNode)
+    solver.popNode();
+  return numberFeasible;
+}
+}
+/*
+  Solve 2**N (N==depth) problems and return solutions and bases.
+  There are N branches each of which changes bounds on both sides
+  as given by branch.  The user should provide an array of (empty)
+  results which will be filled in.  See OsiSolveResult for more details
+  (in OsiSolveBranch.?pp) but it will include a basis and primal solution.
+  
+  The order of results is left to right at feasible leaf nodes so first one
+  is down, down, .....
+  
+  Returns number of feasible leaves.  Also sets number of solves done and number
+  of iterations.
+  
+  This is provided so a solver can do faster.
+  
+  If forceBranch true then branch done even if satisfied
+
+  Bounds are changed between pushNode() and popNode(), so going from one
+  leaf to the next only changes the bounds which differ.
+*/
+int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
+  OsiSolverResult *result,
+  int &numberSolves, int &numberIterations,
+  bool forceBranch)
+{
+  numberIterations = 0;
+  numberSolves = 0;
+  if (depth <= 0)
+    return 0;
+  int numberColumns = getNumCols();
+  double *lowerBefore = CoinCopyOfArray(getColLower(), numberColumns);
+  double *upperBefore = CoinCopyOfArray(getColUpper(), numberColumns);
+  std::vector< BranchSubtree > subtrees;
+  int numberFeasible = enumerateBranches(*this, 0, depth, depth, branch,
+    forceBranch, false, lowerBefore, upperBefore, result, subtrees,
+    numberSolves, numberIterations);
   delete[] lowerBefore;
   delete[] upperBefore;
-#if 0
-  static int xxxxxx=0;
-  static int yyyyyy=0;
-  static int zzzzzz=0;
-  zzzzzz += nFeas;
-  for (int j=0;j<(1<<depth);j++) {
-    xxxxxx++;
-    if ((xxxxxx%10000)==0)
-      printf("%d implicit %d feas %d sent back\n",xxxxxx,zzzzzz,yyyyyy);
-  }
-  for (int j=0;j<numberFeasible;j++) {
-    yyyyyy++;
-    if ((yyyyyy%10000)==0)
-      printf("%d implicit %d feas %d sent back\n",xxxxxx,zzzzzz,yyyyyy);
-  }
+  return numberFeasible;
+}
+/*
+  As solveBranches() above but the top levels are done here and each
+  feasible node below them is finished on a clone, one thread each.
+  Without OpenMP, or with fewer than two threads, this is the virtual
+  solveBranches() so solvers which override that still get used.
+*/
+int OsiSolverInterface::solveBranches(int depth, const OsiSolverBranch *branch,
+  OsiSolverResult *result,
+  int &numberSolves, int &numberIterations,
+  bool forceBranch, int numberThreads)
+{
+#ifndef _OPENMP
+  numberThreads = 0;
+#endif
+  if (numberThreads <= 1 || depth <= 1)
+    return solveBranches(depth, branch, result, numberSolves,
+      numberIterations, forceBranch);
+  numberIterations = 0;
+  numberSolves = 0;
+  int numberColumns = getNumCols();
+  double *lowerBefore = CoinCopyOfArray(getColLower(), numberColumns);
+  double *upperBefore = CoinCopyOfArray(getColUpper(), numberColumns);
+  // split where there are a few subtrees per thread
+  int splitDepth = 1;
+  while (splitDepth < depth - 1 && (1 << splitDepth) < 4 * numberThreads)
+    splitDepth++;
+  std::vector< BranchSubtree > subtrees;
+  enumerateBranches(*this, 0, splitDepth, depth, branch, forceBranch,
+    false, lowerBefore, upperBefore, NULL, subtrees,
+    numberSolves, numberIterations);
+  int numberSubtrees = static_cast< int >(subtrees.size());
+  int maximumLeaves = 1 << (depth - splitDepth);
+  std::vector< OsiSolverResult * > subtreeResult(numberSubtrees);
+  std::vector< int > subtreeFeasible(numberSubtrees, 0);
+  std::vector< int > subtreeSolves(numberSubtrees, 0);
+  std::vector< int > subtreeIterations(numberSubtrees, 0);
+  int i;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numberThreads)
 #endif
+  for (i = 0; i < numberSubtrees; i++) {
+    OsiSolverInterface *solver = subtrees[i].solver;
+    subtreeResult[i] = new OsiSolverResult[maximumLeaves];
+    std::vector< BranchSubtree > noSubtrees;
+    subtreeFeasible[i] = enumerateBranches(*solver, splitDepth, depth, depth,
+      branch, forceBranch, subtrees[i].iterated, lowerBefore, upperBefore,
+      subtreeResult[i], noSubtrees, subtreeSolves[i], subtreeIterations[i]);
+    delete solver;
+  }
+  // same order as if done serially
+  int numberFeasible = 0;
+  for (i = 0; i < numberSubtrees; i++) {
+    for (int j = 0; j < subtreeFeasible[i]; j++)
+      result[numberFeasible++] = subtreeResult[i][j];
+    delete[] subtreeResult[i];
+    numberSolves += subtreeSolves[i];
+    numberIterations += subtreeIterations[i];
+  }
+  delete[] lowerBefore;
+  delete[] upperBefore;
   return numberFeasible;
 }
 #endif
@@ -3190,13 +3740,14 @@ void OsiSolverInterface::statistics(double &minimumNegative, double &maximumNega
   minimumPositive = COIN_DBL_MAX;
   maximumPositive = 0.0;
   // get matrix data pointers
-  const double *elementByColumn = getMatrixByCol()->getElements();
-  const CoinBigIndex *columnStart = getMatrixByCol()->getVectorStarts();
-  const int *columnLength = getMatrixByCol()->getVectorLengths();
-  const int *row = getMatrixByCol()->getIndices();
+  OsiMatrixView matrixByCol = getMatrixViewByCol();
+  const double *elementByColumn = matrixByCol.getElements();
+  const CoinBigIndex *columnStart = matrixByCol.getVectorStarts();
+  const int *columnLength = matrixByCol.getVectorLengths();
+  const int *row = matrixByCol.getIndices();
   int numberColumns = getNumCols();
   int numberRows = getNumRows();
-  CoinBigIndex numberElements = getMatrixByCol()->getNumElements();
+  CoinBigIndex numberElements = matrixByCol.getNumElements();
   int i;
   for (i = 0; i < numberColumns; i++) {
     CoinBigIndex j;
@@ -3475,7 +4026,9 @@ void OsiSolverInterface::checkCGraph(CoinMessageHandler *msgh)
   }
   
   if (cgraph_) {
-    if (cgraph_->size() == getNumCols() * 2) { // cgraph still valid
+    // without model versions only a change in size is seen
+    if (cgraph_->size() == getNumCols() * 2
+      && (!tracksModelVersions() || cgraphVersion_ == cgraphModelVersion(this))) { // cgraph still valid
       return;
     }
 
@@ -3499,6 +4052,8 @@ void OsiSolverInterface::checkCGraph(CoinMessageHandler *msgh)
     setColLower(newBounds[i].first, newBounds[i].second.first);
     setColUpper(newBounds[i].first, newBounds[i].second.second);
   }
+  // after the fixings, which come from the graph itself
+  cgraphVersion_ = cgraphModelVersion(this);
 }
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
@@ -23,6 +23,7 @@
 
 #include "OsiConfig.h"
 #include "OsiCollections.hpp"
+#include "OsiMatrixView.hpp"
 #include "OsiSolverParameters.hpp"
 
 class CoinSnapshot;
@@ -215,11 +216,25 @@ public:
        This is provided so a solver can do faster.
 
        If forceBranch true then branch done even if satisfied
+
+       Going from one leaf to the next only the bounds which differ are
+       changed (see pushNode()).
     */
   virtual int solveBranches(int depth, const OsiSolverBranch *branch,
     OsiSolverResult *result,
     int &numberSolves, int &numberIterations,
     bool forceBranch = false);
+  /**
+       As solveBranches() above but if numberThreads is more than one (and
+       OpenMP is used) the top levels are done on this solver and the
+       subtrees below them on clones, one thread each; the results are in
+       the same order as when done serially.  Otherwise this just calls the
+       virtual solveBranches().
+    */
+  int solveBranches(int depth, const OsiSolverBranch *branch,
+    OsiSolverResult *result,
+    int &numberSolves, int &numberIterations,
+    bool forceBranch, int numberThreads);
 #endif
   //@}
 
@@ -642,8 +657,7 @@ public:
   /// Set column type
   inline void setColumnType(int iColumn, char type)
   {
-    if (!columnType_)
-      getColType(true);
+    getColType();
     columnType_[iColumn] = type;
   }
 
@@ -659,6 +673,12 @@ public:
       binary or general integer will be reevaluated. If the current bounds
       are [0,1], or if the variable is fixed at 0 or 1, it will be classified
       as binary, otherwise it will be classified as general integer.
+      The array is also made again if integralityVersion() has changed
+      and the solver tracksModelVersions(), or if the number of columns
+      has changed.  For other solvers use \p refresh after setInteger()
+      or setContinuous().  Making the array again discards types 0, 1
+      and 2 set with setColumnType(); semi-continuous types (3 and 4) are
+      kept unless \p refresh is true or the number of columns changed.
     */
   virtual const char *getColType(bool refresh = false) const;
 
@@ -682,6 +702,88 @@ public:
     */
   virtual CoinPackedMatrix *getMutableMatrixByCol() const { return NULL; }
 
+  /*! \brief Get a view of the row-wise matrix
+
+      The view points at the solver's own data; nothing is copied.  The
+      default is a view of getMatrixByRow().  A solver which holds the
+      matrix by row may give a view of that instead, and one which holds
+      it in another form may fill a buffer on first use and keep it until
+      the matrix changes.  The view is valid while its version() is
+      matrixVersion().
+    */
+  virtual OsiMatrixView getMatrixViewByRow() const;
+
+  /// Get a view of the column-wise matrix (see getMatrixViewByRow())
+  virtual OsiMatrixView getMatrixViewByCol() const;
+
+  /// Parts of the model with a version number (see modelVersion())
+  enum ModelPart {
+    /// Column bounds (and number of columns)
+    ColBoundsPart = 0,
+    /// Row bounds (and number of rows)
+    RowBoundsPart,
+    /// Objective coefficients and sense
+    ObjectivePart,
+    /// Matrix coefficients and structure
+    MatrixPart,
+    /// Which columns are integer
+    IntegralityPart,
+    /// Solution (primal and dual values)
+    SolutionPart,
+    /// Number of parts
+    NumberModelParts
+  };
+
+  /** Number which changes whenever \p part of the model may have changed.
+
+      Each number only goes up, so a cache made from part of the model
+      can keep the numbers it was made at and be remade only when one of
+      them differs.  Solvers call modelChanged() in every method which
+      changes the model and say so with tracksModelVersions().  For a
+      solver which does not, the numbers never change and tell nothing.
+    */
+  inline unsigned int modelVersion(ModelPart part) const
+  {
+    return modelVersion_[part];
+  }
+  /** True if the solver calls modelChanged() whenever the model changes,
+      so modelVersion() can be trusted.  Callers which cache anything must
+      otherwise remake it each time (or rely on being told). */
+  virtual bool tracksModelVersions() const
+  {
+    return false;
+  }
+  /// modelVersion() of column bounds
+  inline unsigned int colBoundsVersion() const
+  {
+    return modelVersion_[ColBoundsPart];
+  }
+  /// modelVersion() of row bounds
+  inline unsigned int rowBoundsVersion() const
+  {
+    return modelVersion_[RowBoundsPart];
+  }
+  /// modelVersion() of the objective
+  inline unsigned int objectiveVersion() const
+  {
+    return modelVersion_[ObjectivePart];
+  }
+  /// modelVersion() of the matrix
+  inline unsigned int matrixVersion() const
+  {
+    return modelVersion_[MatrixPart];
+  }
+  /// modelVersion() of integrality
+  inline unsigned int integralityVersion() const
+  {
+    return modelVersion_[IntegralityPart];
+  }
+  /// modelVersion() of the solution
+  inline unsigned int solutionVersion() const
+  {
+    return modelVersion_[SolutionPart];
+  }
+
   /// Get the solver's value for infinity
   virtual double getInfinity() const = 0;
   //@}
@@ -889,6 +991,69 @@ public:
     const double *rhsList,
     const double *rangeList);
 
+  /** Start a bound change transaction.
+
+    Until the matching commitModification(), a solver may keep column and
+    row bound changes (setColLower(), setColUpper(), setColBounds(),
+    setRowLower(), setRowUpper(), setRowBounds() and the set versions)
+    instead of passing each one to the underlying solver. They are then
+    applied together, with one setColSetBounds() and one setRowSetBounds()
+    call, so caches are freed once. Transactions nest; changes are applied
+    at the outermost commitModification().
+
+    A solver which does not keep changes applies them at once, which is
+    the default. Inside a transaction, bounds returned by getColLower()
+    and the like may or may not show the changes, and the problem must not
+    be solved or have rows or columns added or deleted.
+  */
+  virtual void beginModification();
+
+  /** End a bound change transaction (see beginModification()).
+
+    At the outermost level, kept changes are applied. If a bound was
+    changed more than once the last value is used.
+  */
+  virtual void commitModification();
+
+  /// True if inside beginModification() and commitModification()
+  inline bool inModification() const
+  {
+    return modificationDepth_ > 0;
+  }
+
+  /** Save the column and row bounds (and maybe the warm start) as a node.
+
+    popNode() puts them back.  Nodes nest, so a depth first search or a
+    dive pushes a node before changing bounds and pops it to backtrack.
+
+    If the solver tracks bound changes (tracksBoundChanges()) only the
+    old value of each bound changed is kept, in a trail, and popNode()
+    costs as much as the changes it undoes.  Otherwise all bounds are
+    copied here and popNode() compares them and changes only those which
+    differ, so both take time in proportion to the number of rows and
+    columns.  Loading a new model forgets all nodes.
+
+    If \p saveWarmStart is true the warm start is saved too and popNode()
+    sets it again.  Rows may be added between pushNode() and popNode();
+    their bounds are not put back.  Solvers which track bound changes
+    also allow rows and columns to be deleted (see trailRowsDeleted()).
+    Neither may be called inside beginModification().
+  */
+  void pushNode(bool saveWarmStart = false);
+  /// Put back the bounds (and warm start) saved by the last pushNode()
+  void popNode();
+  /// Number of nodes pushed and not popped
+  inline int nodeDepth() const
+  {
+    return static_cast< int >(nodeStack_.size());
+  }
+  /** True if the solver tells the base class about every bound change
+      (see trailColBounds()), so pushNode() need not copy all bounds. */
+  virtual bool tracksBoundChanges() const
+  {
+    return false;
+  }
+
   /** Set the primal solution variable values
 
 	colsol[getNumCols()] is an array of values for the primal variables.
@@ -1243,7 +1408,10 @@ public:
   /** Add a set of rows (constraints) to the problem.
     
       The default implementation simply makes repeated calls to
-      addRow().
+      addRow(). applyCuts() and applyRowCuts() add row cuts with it in
+      one call when applyRowCutsWithAddRows() is true, so solvers which
+      can add a block of rows in one go should override both.
+      A NULL \p rowlb or \p rowub means no lower or upper bounds.
     */
   virtual void addRows(const int numrows, const CoinBigIndex *rowStarts,
     const int *columns, const double *element,
@@ -1335,13 +1503,30 @@ public:
 			    getNuminfeasible() +
 			    getNumApplied()
 	</ul>
+	Column cuts are applied one at a time with applyColCut(). All row
+	cuts are checked first. Those accepted are added with a single call
+	to addRows() if applyRowCutsWithAddRows() is true, otherwise with
+	applyRowCut() one at a time.
     */
   virtual ApplyCutsReturnCode applyCuts(const OsiCuts &cs,
     double effectivenessLb = 0.0);
 
+  /** Apply a collection of cuts, keeping only the best row cuts.
+
+	As applyCuts(cs,effectivenessLb), but of the row cuts which pass the
+	checks at most \p maximumRowCuts are added, chosen with
+	OsiCuts::selectRowCuts() against the current primal solution: by
+	decreasing efficacy, skipping cuts whose cosine with a cut already
+	chosen exceeds \p maximumParallelism. Row cuts left out by the
+	selection are counted as ineffective. If \p maximumRowCuts is
+	negative, or there is no primal solution, no selection is done.
+    */
+  ApplyCutsReturnCode applyCuts(const OsiCuts &cs, int maximumRowCuts,
+    double maximumParallelism, double effectivenessLb = 0.0);
+
   /** Apply a collection of row cuts which are all effective.
-	applyCuts seems to do one at a time which seems inefficient.
-	Would be even more efficient to pass an array of pointers.
+	The default gathers them into one block and calls addRows() once if
+	applyRowCutsWithAddRows() is true, else calls applyRowCut() for each.
     */
   virtual void applyRowCuts(int numberCuts, const OsiRowCut *cuts);
 
@@ -1810,7 +1995,12 @@ public:
 
   /*! \brief Sets a conflict graph
    *
-   *  Builds a conflict graph indicating relationship between binary variables
+   *  Builds a conflict graph indicating relationship between binary variables.
+   *  An existing graph is kept unless the number of columns has changed
+   *  or, if the solver tracksModelVersions(), the column bounds, row
+   *  bounds, matrix or integrality have changed since it was built.  For
+   *  other solvers only the number of columns is checked, as before model
+   *  versions were kept.
    */
   void checkCGraph(CoinMessageHandler *msgh = NULL);
   
@@ -2097,6 +2287,12 @@ protected:
   /** Apply a row cut (append to the constraint matrix). */
   virtual void applyRowCut(const OsiRowCut &rc) = 0;
 
+  /** True if applyCuts() and applyRowCuts() may add row cuts with one call
+      to addRows() instead of calling applyRowCut() for each. The default is
+      false so that applyRowCut() is always used; a solver whose
+      applyRowCut() only adds the row may return true. */
+  virtual bool applyRowCutsWithAddRows() const { return false; }
+
   /** Apply a column cut (adjust the bounds of one or more variables). */
   virtual void applyColCut(const OsiColCut &cc) = 0;
 
@@ -2126,6 +2322,56 @@ protected:
       default constructor.
     */
   void setInitialData();
+  /// Note that \p part of the model may have changed (see modelVersion())
+  inline void modelChanged(ModelPart part)
+  {
+    modelVersion_[part]++;
+  }
+  /// Note that all of the model may have changed, as after loadProblem()
+  void modelChanged();
+  /** Keep a column bound change if a transaction is open.
+
+    For solvers which keep bound changes (see beginModification()).
+    \p lower or \p upper is NULL if that bound is not changed. Returns
+    true if the change was kept, in which case the caller does nothing
+    more; false if there is no transaction and the caller should change
+    the bound now.
+  */
+  bool bufferColBounds(int index, const double *lower, const double *upper);
+  /// As bufferColBounds() for a row
+  bool bufferRowBounds(int index, const double *lower, const double *upper);
+  /** Keep the bounds of column \p index on the node trail (see
+      pushNode()).  Solvers whose tracksBoundChanges() is true call this
+      before every change to column bounds, and trailRowBounds() before
+      every change to row bounds. */
+  inline void trailColBounds(int index)
+  {
+    if (!nodeStack_.empty() && !undoingTrail_)
+      addToTrail(index, false);
+  }
+  /// As trailColBounds() for a row
+  inline void trailRowBounds(int index)
+  {
+    if (!nodeStack_.empty() && !undoingTrail_)
+      addToTrail(index, true);
+  }
+  /** Rows \p indices have been deleted: forget their saved bounds and
+      renumber the rest.  Solvers whose tracksBoundChanges() is true call
+      this from deleteRows(), and trailColsDeleted() from deleteCols(). */
+  inline void trailRowsDeleted(int num, const int *indices)
+  {
+    if (!nodeStack_.empty())
+      removeFromTrail(num, indices, true);
+  }
+  /// As trailRowsDeleted() for columns
+  inline void trailColsDeleted(int num, const int *indices)
+  {
+    if (!nodeStack_.empty())
+      removeFromTrail(num, indices, false);
+  }
+  /** Forget all nodes pushed.  Solvers call this when a new model is
+      loaded, as the bounds saved belong to the old one. */
+  void clearNodeStack();
   //@}
 
   ///@name Protected member data
@@ -2162,6 +2408,10 @@ protected:
       4 - if supported - semi-continuous integer
   */
   mutable char *columnType_;
+  /// integralityVersion() when columnType_ was made
+  mutable unsigned int columnTypeVersion_;
+  /// Number of entries in columnType_
+  mutable int columnTypeSize_;
 
   //@}
 
@@ -2198,6 +2448,76 @@ private:
   //@}
 
   CoinStaticConflictGraph *cgraph_;
+  /// Sum of the versions of the parts cgraph_ was made from
+  unsigned int cgraphVersion_;
+
+  /// Bound changes kept during a transaction
+  struct BoundBuffer {
+    /// Indices in order first changed
+    std::vector< int > indices;
+    /// Lower and upper bound for each index
+    std::vector< double > bounds;
+    /// Bounds set for each index (1 lower, 2 upper)
+    std::vector< char > which;
+    /// Position of each row or column in indices (-1 if none)
+    std::vector< int > position;
+  };
+  /// Keep a change in \p buffer
+  static void bufferBounds(BoundBuffer &buffer, int index, int number,
+    const double *lower, const double *upper);
+  /// Forget kept changes
+  void clearModification();
+  /// Column bound changes kept
+  BoundBuffer columnBuffer_;
+  /// Row bound changes kept
+  BoundBuffer rowBuffer_;
+  /// Depth of beginModification() calls
+  int modificationDepth_;
+  /// See modelVersion()
+  unsigned int modelVersion_[NumberModelParts];
+
+  /// Old bounds of a row or column
+  struct TrailEntry {
+    /// Row or column
+    int index;
+    /// True if a row
+    bool isRow;
+    /// Lower bound before change
+    double lower;
+    /// Upper bound before change
+    double upper;
+  };
+  /// What pushNode() saved
+  struct NodeLevel {
+    /// Start of this node's entries in boundTrail_
+    int trailStart;
+    /// Warm start or NULL (owned)
+    CoinWarmStart *warmStart;
+    /// True if all bounds were copied (solver does not track changes)
+    bool copied;
+    /// Number of rows when pushed (later rows are not trailed)
+    int numberRows;
+    /// Number of columns when pushed
+    int numberColumns;
+    /// Column lower bounds if copied
+    std::vector< double > colLower;
+    /// Column upper bounds if copied
+    std::vector< double > colUpper;
+    /// Row lower bounds if copied
+    std::vector< double > rowLower;
+    /// Row upper bounds if copied
+    std::vector< double > rowUpper;
+  };
+  /// Add old bounds of a row or column to boundTrail_
+  void addToTrail(int index, bool isRow);
+  /// Drop deleted rows or columns from the node stack and renumber
+  void removeFromTrail(int num, const int *indices, bool isRow);
+  /// Old bounds, latest last
+  std::vector< TrailEntry > boundTrail_;
+  /// Nodes pushed
+  std::vector< NodeLevel > nodeStack_;
+  /// True while popNode() puts bounds back
+  bool undoingTrail_;
 };
 
 //#############################################################################
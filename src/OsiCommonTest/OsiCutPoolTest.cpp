@@ -0,0 +1,111 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include "OsiUnitTests.hpp"
+
+#include "OsiCutPool.hpp"
+#include "OsiCuts.hpp"
+
+//--------------------------------------------------------------------------
+void OsiCutPoolUnitTest()
+{
+  // Test default constructor
+  {
+    OsiCutPool p;
+    OSIUNITTEST_ASSERT_ERROR(p.numberCuts() == 0, {}, "osicutpool", "default constructor");
+    OSIUNITTEST_ASSERT_ERROR(p.numberInSolver() == 0, {}, "osicutpool", "default constructor");
+    OSIUNITTEST_ASSERT_ERROR(p.maximumRowAge() == 5 && p.maximumPoolAge() == 50, {}, "osicutpool", "default constructor");
+  }
+
+  // Cuts x0 + x1 <= 1, x1 + x2 <= 1 and x0 + x2 <= 1 (globally valid) and
+  // x0 + x1 + x2 <= 1 (local)
+  int ind[3][2] = { { 0, 1 }, { 1, 2 }, { 2, 0 } };
+  double el[2] = { 1.0, 1.0 };
+  OsiRowCut rc[4];
+  int i;
+  for (i = 0; i < 3; i++) {
+    rc[i].setRow(2, ind[i], el);
+    rc[i].setUb(1.0);
+    rc[i].setGloballyValid(true);
+  }
+  int all[3] = { 0, 1, 2 };
+  double all_el[3] = { 1.0, 1.0, 1.0 };
+  rc[3].setRow(3, all, all_el);
+  rc[3].setUb(1.0);
+
+  // Adding cuts
+  {
+    OsiCutPool p;
+    OSIUNITTEST_ASSERT_ERROR(p.insert(rc[0]), {}, "osicutpool", "insert");
+    OSIUNITTEST_ASSERT_ERROR(!p.insert(rc[3]), {}, "osicutpool", "insert ignores local cuts");
+    OSIUNITTEST_ASSERT_ERROR(!p.insert(rc[0]), {}, "osicutpool", "insert ignores duplicates");
+    OsiCuts cs;
+    for (i = 0; i < 4; i++)
+      cs.insert(rc[i]);
+    OSIUNITTEST_ASSERT_ERROR(p.insert(cs) == 2, {}, "osicutpool", "insert collection");
+    OSIUNITTEST_ASSERT_ERROR(p.numberCuts() == 3, {}, "osicutpool", "insert collection");
+    // x0 + x2 was stored with indices sorted
+    OSIUNITTEST_ASSERT_ERROR(p.rowCut(2).row().getIndices()[0] == 0, {}, "osicutpool", "insert collection");
+    OSIUNITTEST_ASSERT_ERROR(p.rowCut(2).globallyValid() && p.rowCut(2).ub() == 1.0, {}, "osicutpool", "get cut");
+    bool rows_ok = true;
+    for (i = 0; i < 3; i++)
+      rows_ok &= p.row(i) == -1 && p.age(i) == 0;
+    OSIUNITTEST_ASSERT_ERROR(rows_ok, {}, "osicutpool", "insert collection");
+  }
+
+  // Separating, aging and purging
+  {
+    OsiCutPool p(5, 2);
+    for (i = 0; i < 3; i++)
+      p.insert(rc[i]);
+    double x[3] = { 1.0, 0.5, 0.0 };
+    OsiCuts cs;
+    // only x0 + x1 <= 1 is violated
+    OSIUNITTEST_ASSERT_ERROR(p.separate(x, cs) == 1, {}, "osicutpool", "separate");
+    OsiRowCut violated = rc[0];
+    violated.setEffectiveness(0.5);
+    OSIUNITTEST_ASSERT_ERROR(cs.sizeRowCuts() == 1 && cs.rowCut(0) == violated, {}, "osicutpool", "separate");
+    OSIUNITTEST_ASSERT_ERROR(p.age(0) == 0 && p.age(1) == 1 && p.age(2) == 1, {}, "osicutpool", "separate");
+    OSIUNITTEST_ASSERT_ERROR(p.purge() == 0, {}, "osicutpool", "purge");
+
+    // copy keeps everything
+    OsiCutPool q(p);
+    OSIUNITTEST_ASSERT_ERROR(q.numberCuts() == 3 && q.age(1) == 1 && q.maximumPoolAge() == 2, {}, "osicutpool", "copy constructor");
+
+    x[2] = 1.0; // now x1 + x2 and x0 + x2 are violated too
+    p.separate(x, cs);
+    x[0] = x[1] = x[2] = 0.0;
+    p.separate(x, cs);
+    p.separate(x, cs);
+    OSIUNITTEST_ASSERT_ERROR(p.age(0) == 2 && p.age(1) == 2, {}, "osicutpool", "separate");
+    q.separate(x, cs);
+    q.separate(x, cs);
+    OSIUNITTEST_ASSERT_ERROR(q.purge() == 2 && q.numberCuts() == 1, {}, "osicutpool", "purge");
+    OSIUNITTEST_ASSERT_ERROR(q.rowCut(0) == rc[0], {}, "osicutpool", "purge");
+    // index still finds the cut left
+    OSIUNITTEST_ASSERT_ERROR(!q.insert(rc[0]) && q.insert(rc[1]), {}, "osicutpool", "purge");
+
+    p.clear();
+    OSIUNITTEST_ASSERT_ERROR(p.numberCuts() == 0 && p.insert(rc[1]), {}, "osicutpool", "clear");
+  }
+
+  // Binary files
+  {
+    OsiCutPool p;
+    for (i = 0; i < 3; i++)
+      p.insert(rc[i]);
+    FILE *fp = tmpfile();
+    OSIUNITTEST_ASSERT_ERROR(fp != NULL, return, "osicutpool", "binary files");
+    OSIUNITTEST_ASSERT_ERROR(p.writeBinary(fp) == 0, {}, "osicutpool", "binary files");
+    rewind(fp);
+    OsiCutPool q;
+    q.insert(rc[1]);
+    OSIUNITTEST_ASSERT_ERROR(q.readBinary(fp) == 0, {}, "osicutpool", "binary files");
+    fclose(fp);
+    // rc[1] was there already
+    OSIUNITTEST_ASSERT_ERROR(q.numberCuts() == 3 && q.rowCut(0) == rc[1] && q.rowCut(1) == rc[0], {}, "osicutpool", "binary files");
+  }
+}
@@ -7,6 +7,7 @@
 #include "OsiUnitTests.hpp"
 
 #include "OsiCuts.hpp"
+#include "OsiConcurrentCuts.hpp"
 
 //--------------------------------------------------------------------------
 void OsiCutsUnitTest()
@@ -191,6 +192,462 @@ void OsiCutsUnitTest()
     OSIUNITTEST_ASSERT_ERROR(eq(t.mostEffectiveCutPtr()->effectiveness(), 203.0), {}, "osicuts", "removing cuts");
   }
 
+  // inserting row cuts unless duplicate
+  {
+    OsiCuts t;
+    int ind[3] = { 4, 1, 7 };
+    double el[3] = { 1.0, 2.0, 3.0 };
+    OsiRowCut rc;
+    rc.setRow(3, ind, el);
+    rc.setLb(-COIN_DBL_MAX);
+    rc.setUb(5.0);
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDuplicate(rc), {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(rc), {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 1, {}, "osicuts", "insert if not duplicate");
+    // stored cut is sorted
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(0).row().getIndices()[0] == 1, {}, "osicuts", "insert if not duplicate");
+
+    // same within tolerance
+    OsiRowCut rc2(rc);
+    rc2.setUb(5.0 + 1.0e-14);
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(rc2), {}, "osicuts", "insert if not duplicate");
+    rc2.setUb(5.0 + 1.0e-6);
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(rc2, CoinAbsFltEq(1.0e-5)), {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDuplicate(rc2), {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 2, {}, "osicuts", "insert if not duplicate");
+
+    // relative tolerance
+    OsiRowCut rc3(rc);
+    rc3.mutableRow().setElement(2, 3.0 * (1.0 + 1.0e-12));
+    t.insertIfNotDuplicate(rc3, CoinRelFltEq(1.0e-10));
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 2, {}, "osicuts", "insert if not duplicate");
+    rc3.mutableRow().setElement(2, 3.5);
+    t.insertIfNotDuplicate(rc3, CoinRelFltEq(1.0e-10));
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 3, {}, "osicuts", "insert if not duplicate");
+
+    // different support
+    int ind4[2] = { 1, 4 };
+    OsiRowCut rc4;
+    rc4.setRow(2, ind4, el);
+    rc4.setUb(5.0);
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDuplicate(rc4), {}, "osicuts", "insert if not duplicate");
+
+    // index must follow removal of cuts
+    t.eraseRowCut(0);
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDuplicate(rc), {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(rc4), {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 4, {}, "osicuts", "insert if not duplicate");
+
+    // and many cuts
+    OsiCuts u;
+    bool many_ok = true;
+    for (i = 0; i < 5000; i++) {
+      int indMany[2] = { i, i + 1 + (i % 7) };
+      double elMany[2] = { 1.0, -1.0 };
+      OsiRowCut rcMany;
+      rcMany.setRow(2, indMany, elMany);
+      rcMany.setUb(static_cast< double >(i % 3));
+      many_ok &= u.insertIfNotDuplicate(rcMany);
+      many_ok &= !u.insertIfNotDuplicate(rcMany);
+    }
+    OSIUNITTEST_ASSERT_ERROR(many_ok, {}, "osicuts", "insert if not duplicate");
+    OSIUNITTEST_ASSERT_ERROR(u.sizeRowCuts() == 5000, {}, "osicuts", "insert if not duplicate");
+  }
+
+  // packed storage of row cuts
+  {
+    OsiCuts t;
+    t.setPackedRowCuts(true);
+    OSIUNITTEST_ASSERT_ERROR(t.packedRowCuts(), {}, "osicuts", "packed row cuts");
+    int ind[3] = { 1, 4, 7 };
+    double el[3] = { 1.0, 2.0, 3.0 };
+    OsiRowCut prc[4];
+    for (i = 0; i < 4; i++) {
+      prc[i].setRow(3 - (i % 2), ind, el);
+      prc[i].setLb(-1.0 - i);
+      prc[i].setUb(10.0 + i);
+      prc[i].setEffectiveness(1.0 + i);
+      prc[i].setGloballyValid(i % 2 == 0);
+      t.insert(prc[i]);
+    }
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 4, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.packedRowCutElements() == 10, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCutPtrs_[2] == NULL, {}, "osicuts", "packed row cuts");
+    OsiCuts::RowCutView view = t.rowCutView(1);
+    OSIUNITTEST_ASSERT_ERROR(view.numberElements == 2 && view.indices[1] == 4 && view.elements[1] == 2.0, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(view.lb == -2.0 && view.ub == 11.0 && view.effectiveness == 2.0, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCutPtrs_[1] == NULL, {}, "osicuts", "packed row cuts");
+    bool packed_ok = true;
+    for (i = 0; i < 4; i++)
+      packed_ok &= t.rowCut(i) == prc[i];
+    OSIUNITTEST_ASSERT_ERROR(packed_ok, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(2).globallyValid() && !t.rowCut(3).globallyValid(), {}, "osicuts", "packed row cuts");
+
+    // changes through the object are seen everywhere
+    t.rowCut(0).setUb(20.0);
+    OSIUNITTEST_ASSERT_ERROR(t.rowCutView(0).ub == 20.0, {}, "osicuts", "packed row cuts");
+
+    // copy, sort and erase
+    OsiCuts u(t);
+    OSIUNITTEST_ASSERT_ERROR(u.packedRowCuts() && u.sizeRowCuts() == 4, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(u.rowCut(0).ub() == 20.0 && u.rowCut(3) == prc[3], {}, "osicuts", "packed row cuts");
+    t.sort();
+    packed_ok = true;
+    for (i = 1; i < 4; i++)
+      packed_ok &= t.rowCutView(i - 1).effectiveness > t.rowCutView(i).effectiveness;
+    OSIUNITTEST_ASSERT_ERROR(packed_ok, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(0) == prc[3], {}, "osicuts", "packed row cuts");
+    t.eraseRowCut(1);
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 3, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(1) == prc[1], {}, "osicuts", "packed row cuts");
+
+    // duplicates and pointers mixed with packed cuts
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(prc[1]), {}, "osicuts", "packed row cuts");
+    OsiRowCut *rcP = prc[2].clone();
+    t.insert(rcP);
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 4 && t.rowCut(3) == prc[2], {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(prc[2]), {}, "osicuts", "packed row cuts");
+
+    // back to separate objects
+    t.setPackedRowCuts(false);
+    OSIUNITTEST_ASSERT_ERROR(!t.packedRowCuts() && t.packedRowCutElements() == 0, {}, "osicuts", "packed row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 4 && t.rowCut(1) == prc[1], {}, "osicuts", "packed row cuts");
+  }
+
+  // derived row cuts are kept as objects among packed ones
+  {
+    OsiCuts t;
+    t.setPackedRowCuts(true);
+    int ind[2] = { 0, 3 };
+    double el[2] = { 1.0, 2.0 };
+    OsiRowCut prc;
+    prc.setRow(2, ind, el);
+    prc.setUb(4.0);
+    prc.setEffectiveness(1.0);
+    OsiRowCut2 drc(5);
+    drc.setRow(1, ind, el);
+    drc.setUb(3.0);
+    drc.setEffectiveness(2.0);
+    t.insert(prc);
+    t.insert(drc);
+    t.insert(prc);
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 3 && t.rowCutLengths_.size() == 3, {}, "osicuts", "derived row cuts");
+    const OsiRowCut2 *cut2 = dynamic_cast< const OsiRowCut2 * >(t.rowCutPtrs_[1]);
+    OSIUNITTEST_ASSERT_ERROR(cut2 && cut2->whichRow() == 5 && t.rowCutView(1).ub == 3.0, {}, "osicuts", "derived row cuts");
+    t.sort();
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(0) == drc && t.rowCut(2) == prc, {}, "osicuts", "derived row cuts");
+    t.eraseRowCut(0);
+    OSIUNITTEST_ASSERT_ERROR(t.sizeRowCuts() == 2 && t.rowCutLengths_.size() == 2, {}, "osicuts", "derived row cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCutView(0).numberElements == 2 && t.rowCut(1) == prc, {}, "osicuts", "derived row cuts");
+
+    // a cut changed through rowCutPtr() is found under its new support
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(prc), {}, "osicuts", "derived row cuts: index");
+    OsiRowCut *changed = t.rowCutPtr(1);
+    changed->setRow(1, ind, el);
+    changed->setUb(3.0);
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(drc) && t.sizeRowCuts() == 2, {}, "osicuts", "derived row cuts: index");
+  }
+
+  // erasing packed cuts gives back their coefficients
+  {
+    OsiCuts t;
+    t.setPackedRowCuts(true);
+    int ind[5] = { 0, 1, 2, 3, 4 };
+    double el[5] = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+    for (i = 0; i < 300; i++) {
+      OsiRowCut prc;
+      prc.setRow(5, ind, el);
+      prc.setUb(i);
+      t.insert(prc);
+    }
+    for (i = 0; i < 250; i++)
+      t.eraseRowCut(0);
+    bool compact_ok = t.sizeRowCuts() == 50 && t.rowCutIndices_.size() < 1500;
+    for (i = 0; compact_ok && i < 50; i++) {
+      OsiCuts::RowCutView cut = t.rowCutView(i);
+      compact_ok = cut.numberElements == 5 && cut.indices[4] == 4 && cut.elements[4] == 5.0 && cut.ub == 250 + i;
+    }
+    OSIUNITTEST_ASSERT_ERROR(compact_ok, {}, "osicuts", "packed row cuts: erase");
+  }
+
+  // packed cuts with +1/-1 coefficients
+  {
+    OsiCuts t;
+    t.setPackedRowCuts(true);
+    int clique[3] = { 2, 5, 9 };
+    double ones[3] = { 1.0, 1.0, 1.0 };
+    int cover[4] = { 8, 1, 6, 3 };
+    double signs[4] = { -1.0, 1.0, 1.0, -1.0 };
+    OsiRowCut unit[2];
+    unit[0].setRow(3, clique, ones);
+    unit[0].setUb(1.0);
+    unit[0].setEffectiveness(1.0);
+    unit[1].setRow(4, cover, signs);
+    unit[1].setUb(0.0);
+    unit[1].setEffectiveness(2.0);
+    t.insert(unit[0]);
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDuplicate(unit[1]), {}, "osicuts", "unit coefficient cuts");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCutElements_.empty() && t.packedRowCutElements() == 7, {}, "osicuts", "unit coefficient cuts");
+    OsiCuts::RowCutView view = t.rowCutView(1);
+    // sorted, then +1 columns before -1 columns
+    OSIUNITTEST_ASSERT_ERROR(view.indices[0] == 1 && view.indices[1] == 6 && view.indices[2] == 3 && view.indices[3] == 8, {}, "osicuts", "unit coefficient cuts");
+    OSIUNITTEST_ASSERT_ERROR(view.elements[0] == 1.0 && view.elements[1] == 1.0 && view.elements[2] == -1.0 && view.elements[3] == -1.0, {}, "osicuts", "unit coefficient cuts");
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDuplicate(unit[1]), {}, "osicuts", "unit coefficient cuts");
+    double x[10] = { 0.0, 1.0, 0.5, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.5 };
+    double violation[2];
+    t.computeViolations(x, violation);
+    OSIUNITTEST_ASSERT_ERROR(violation[0] == 0.5 && violation[1] == 1.0, {}, "osicuts", "unit coefficient cuts");
+    t.sort();
+    OsiCuts u(t);
+    OSIUNITTEST_ASSERT_ERROR(u.rowCutElements_.empty() && u.sizeRowCuts() == 2, {}, "osicuts", "unit coefficient cuts");
+    OSIUNITTEST_ASSERT_ERROR(u.rowCut(1) == unit[0] && u.rowCut(0).violated(x) == 1.0, {}, "osicuts", "unit coefficient cuts");
+    t.eraseRowCut(0);
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(0) == unit[0], {}, "osicuts", "unit coefficient cuts");
+  }
+
+  // scaled and dominated row cuts
+  {
+    int ind[2] = { 0, 1 };
+    double el[4][2] = { { 1.0, 2.0 }, { 2.0, 4.0 }, { 0.5, 1.0 }, { -1.0, -2.0 } };
+    OsiRowCut drc[4];
+    for (i = 0; i < 4; i++)
+      drc[i].setRow(2, ind, el[i]);
+    drc[0].setUb(4.0); // x0 + 2x1 <= 4
+    drc[1].setUb(10.0); // weaker multiple
+    drc[2].setUb(1.0); // tighter multiple
+    drc[2].setEffectiveness(3.0);
+    drc[3].setUb(0.0); // negative multiple, a different cut
+    OsiCuts t;
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDominated(drc[0]), {}, "osicuts", "dominated cuts");
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDominated(drc[1]) && t.rowCut(0).ub() == 4.0, {}, "osicuts", "dominated cuts");
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDominated(drc[2]) && t.sizeRowCuts() == 1, {}, "osicuts", "dominated cuts: tighten");
+    OSIUNITTEST_ASSERT_ERROR(t.rowCut(0).ub() == 2.0 && t.rowCut(0).effectiveness() == 3.0, {}, "osicuts", "dominated cuts: tighten");
+    OSIUNITTEST_ASSERT_ERROR(t.insertIfNotDominated(drc[3]) && t.sizeRowCuts() == 2, {}, "osicuts", "dominated cuts: negative multiple");
+    drc[1].setLb(2.0); // 2x0 + 4x1 >= 2 gives a range
+    OSIUNITTEST_ASSERT_ERROR(!t.insertIfNotDominated(drc[1]) && t.rowCut(0).lb() == 1.0 && t.rowCut(0).ub() == 2.0, {}, "osicuts", "dominated cuts: range");
+    // a local cut does not tighten a global one
+    OsiCuts u;
+    drc[0].setGloballyValid(true);
+    u.insert(drc[0]);
+    OSIUNITTEST_ASSERT_ERROR(u.insertIfNotDominated(drc[2]) && u.sizeRowCuts() == 2 && u.rowCut(0).ub() == 4.0, {}, "osicuts", "dominated cuts: local");
+    // nor a global one owned elsewhere
+    OsiRowCut owned(drc[0]); // outlives w, which looks at it when destroyed
+    owned.setGloballyValidAsInteger(2);
+    OsiCuts w;
+    OsiRowCut *ownedPtr = &owned;
+    w.insert(ownedPtr);
+    OSIUNITTEST_ASSERT_ERROR(w.insertIfNotDominated(drc[2]) && w.sizeRowCuts() == 2 && owned.ub() == 4.0, {}, "osicuts", "dominated cuts: owned elsewhere");
+
+    // packed x1 - x0 <= 1 is stored x1 first, 2x1 - 2x0 is sorted
+    OsiCuts v;
+    v.setPackedRowCuts(true);
+    double unitEl[2] = { -1.0, 1.0 };
+    double twoEl[2] = { -2.0, 2.0 };
+    OsiRowCut urc[2];
+    urc[0].setRow(2, ind, unitEl);
+    urc[0].setUb(1.0);
+    urc[1].setRow(2, ind, twoEl);
+    urc[1].setUb(1.0);
+    OSIUNITTEST_ASSERT_ERROR(v.insertIfNotDominated(urc[0]) && v.rowCutView(0).indices[0] == 1, {}, "osicuts", "dominated cuts: packed");
+    OSIUNITTEST_ASSERT_ERROR(!v.insertIfNotDominated(urc[1]) && v.sizeRowCuts() == 1 && v.rowCut(0).ub() == 0.5, {}, "osicuts", "dominated cuts: packed");
+  }
+
+  // violations and efficacy of all row cuts
+  {
+    int ind[5] = { 0, 1, 2, 3, 4 };
+    double el[5] = { 1.0, 1.0, 1.0, 1.0, 1.0 };
+    double x[5] = { 1.0, 1.0, 1.0, 1.0, 1.0 };
+    bool violations_ok = true;
+    for (int packed = 0; packed < 2; packed++) {
+      OsiCuts t;
+      t.setPackedRowCuts(packed != 0);
+      OsiRowCut vrc[3];
+      vrc[0].setRow(4, ind, el); // activity 4, norm 2
+      vrc[0].setUb(2.0);
+      vrc[1].setRow(5, ind, el); // activity 5, satisfied
+      vrc[1].setLb(0.0);
+      vrc[1].setUb(5.0);
+      vrc[2].setRow(1, ind, el); // activity 1, norm 1
+      vrc[2].setLb(4.0);
+      for (i = 0; i < 3; i++)
+        t.insert(vrc[i]);
+      double violation[3];
+      double efficacy[3];
+      t.computeViolations(x, violation, efficacy);
+      for (i = 0; i < 3; i++)
+        violations_ok &= violation[i] == vrc[i].violated(x);
+      violations_ok &= efficacy[0] == 1.0 && efficacy[1] == 0.0 && efficacy[2] == 3.0;
+      t.computeViolations(x, violation);
+      violations_ok &= violation[0] == 2.0 && violation[2] == 3.0;
+    }
+    OSIUNITTEST_ASSERT_ERROR(violations_ok, {}, "osicuts", "compute violations");
+  }
+
+  // selecting row cuts by efficacy and parallelism
+  {
+    int ind[2] = { 0, 1 };
+    double x[2] = { 1.0, 1.0 };
+    double el[4][2] = { { 1.0, 0.0 }, { 1.0, 0.1 }, { 0.0, 1.0 }, { 1.0, 1.0 } };
+    double ub[4] = { 0.0, 0.0, 0.5, 2.0 };
+    OsiCuts t;
+    for (i = 0; i < 4; i++) {
+      OsiRowCut src;
+      src.setRow(2, ind, el[i]);
+      src.setUb(ub[i]);
+      t.insert(src);
+    }
+    // efficacies are 1.0, 1.1/|(1,0.1)|, 0.5 and 0.0
+    int which[4];
+    int numberSelected = t.selectRowCuts(x, 4, 0.9, which);
+    OSIUNITTEST_ASSERT_ERROR(numberSelected == 2, {}, "osicuts", "select row cuts");
+    OSIUNITTEST_ASSERT_ERROR(which[0] == 1 && which[1] == 2, {}, "osicuts", "select row cuts");
+    numberSelected = t.selectRowCuts(x, 1, 1.0, which);
+    OSIUNITTEST_ASSERT_ERROR(numberSelected == 1 && which[0] == 1, {}, "osicuts", "select row cuts");
+    which[0] = 0;
+    which[1] = 2;
+    which[2] = 3;
+    numberSelected = t.selectRowCuts(x, 4, 1.0, which, 3);
+    OSIUNITTEST_ASSERT_ERROR(numberSelected == 2 && which[0] == 0 && which[1] == 2, {}, "osicuts", "select row cuts");
+  }
+
+  // building cuts in place
+  {
+    int ind[3] = { 1, 4, 7 };
+    double el[3] = { 1.0, 2.0, 3.0 };
+    OsiRowCut expected;
+    expected.setRow(3, ind, el);
+    expected.setLb(-1.0);
+    expected.setUb(2.0);
+    expected.setEffectiveness(5.0);
+    expected.setGloballyValid(true);
+    bool emplace_ok = true;
+    for (int packed = 0; packed < 2; packed++) {
+      OsiCuts t;
+      t.setPackedRowCuts(packed != 0);
+      t.emplaceRowCut(-1.0, 2.0, 3, ind, el, 5.0, true);
+      // no object when packed
+      emplace_ok &= (t.rowCutPtrs_[0] == NULL) == (packed != 0);
+      emplace_ok &= t.sizeRowCuts() == 1 && t.rowCut(0) == expected;
+      emplace_ok &= t.rowCut(0).globallyValid();
+    }
+    OSIUNITTEST_ASSERT_ERROR(emplace_ok, {}, "osicuts", "emplace row cut");
+    OsiCuts t;
+    t.emplaceColCut(2, ind, el, 1, ind + 2, el + 2, 3.0);
+    OSIUNITTEST_ASSERT_ERROR(t.sizeColCuts() == 1 && t.colCut(0).effectiveness() == 3.0, {}, "osicuts", "emplace col cut");
+    OSIUNITTEST_ASSERT_ERROR(t.colCut(0).lbs().getNumElements() == 2 && t.colCut(0).ubs().getIndices()[0] == 7, {}, "osicuts", "emplace col cut");
+  }
+
+  // moving cuts between collections
+  {
+    int ind[3] = { 1, 4, 7 };
+    int rev[3] = { 7, 4, 1 };
+    double el[3] = { 1.0, 2.0, 3.0 };
+    double rel[3] = { 3.0, 2.0, 1.0 };
+    OsiRowCut *a = new OsiRowCut();
+    a->setRow(3, ind, el);
+    a->setUb(1.0);
+    OsiRowCut b;
+    b.setRow(3, rev, rel); // same as a once sorted
+    b.setUb(1.0);
+    OsiRowCut c;
+    c.setRow(2, ind, el);
+    c.setUb(1.0);
+    OsiCuts from;
+    const OsiRowCut *aAddress = a;
+    from.insert(a);
+    from.insert(ccv[0]);
+    OsiCuts packed;
+    packed.setPackedRowCuts(true);
+    packed.insert(b);
+    packed.insert(c);
+    OsiCuts to;
+    OSIUNITTEST_ASSERT_ERROR(to.transfer(from) == 0, {}, "osicuts", "transfer");
+    OSIUNITTEST_ASSERT_ERROR(from.sizeCuts() == 0, {}, "osicuts", "transfer");
+    OSIUNITTEST_ASSERT_ERROR(to.sizeRowCuts() == 1 && to.rowCutPtr(0) == aAddress, {}, "osicuts", "transfer without cloning");
+    OSIUNITTEST_ASSERT_ERROR(to.sizeColCuts() == 1 && to.colCut(0) == ccv[0], {}, "osicuts", "transfer");
+    OSIUNITTEST_ASSERT_ERROR(to.transfer(packed) == 1, {}, "osicuts", "transfer removes duplicates");
+    OSIUNITTEST_ASSERT_ERROR(to.sizeRowCuts() == 2 && to.rowCut(1) == c && packed.sizeRowCuts() == 0, {}, "osicuts", "transfer");
+    // a duplicate owned elsewhere is dropped, not deleted
+    OsiRowCut owned(c);
+    owned.setGloballyValidAsInteger(2);
+    OsiRowCut *ownedPtr = &owned;
+    OsiCuts fromOwned;
+    fromOwned.insert(ownedPtr);
+    OSIUNITTEST_ASSERT_ERROR(to.transfer(fromOwned) == 1 && owned == c, {}, "osicuts", "transfer: owned elsewhere");
+
+    OsiConcurrentCuts collector(2);
+    int first = collector.reserveShard();
+    int second = collector.reserveShard();
+    OSIUNITTEST_ASSERT_ERROR(first == 0 && second == 1 && collector.reserveShard() == -1, {}, "osicuts", "concurrent cuts");
+    OSIUNITTEST_ASSERT_ERROR(collector.numberReserved() == 2, {}, "osicuts", "concurrent cuts");
+    collector.shard(first).insert(b);
+    collector.shard(second).insert(c);
+    collector.shard(second).insert(*aAddress);
+    OsiCuts merged;
+    OSIUNITTEST_ASSERT_ERROR(collector.mergeInto(merged) == 1, {}, "osicuts", "concurrent cuts");
+    OSIUNITTEST_ASSERT_ERROR(merged.sizeRowCuts() == 2 && merged.rowCut(1) == c, {}, "osicuts", "concurrent cuts");
+    OSIUNITTEST_ASSERT_ERROR(collector.numberReserved() == 0 && collector.reserveShard() == 0, {}, "osicuts", "concurrent cuts");
+  }
+
+  // binary files
+  {
+    OsiCuts t(cuts);
+    t.rowCut(1).setGloballyValid(true);
+    t.colCut(2).setGloballyValid(true);
+    OsiCuts packed;
+    packed.setPackedRowCuts(true);
+    packed.insert(rcv[3]);
+    FILE *fp = tmpfile();
+    OSIUNITTEST_ASSERT_ERROR(fp != NULL, return, "osicuts", "binary files");
+    OSIUNITTEST_ASSERT_ERROR(t.writeBinary(fp) == 0 && packed.writeBinary(fp) == 0, {}, "osicuts", "binary files");
+    long length = ftell(fp);
+    rewind(fp);
+    OsiCuts u;
+    OSIUNITTEST_ASSERT_ERROR(u.readBinary(fp) == 0 && u.readBinary(fp) == 0, {}, "osicuts", "binary files");
+    bool binary_ok = u.sizeRowCuts() == t.sizeRowCuts() + 1 && u.sizeColCuts() == t.sizeColCuts();
+    for (i = 0; binary_ok && i < t.sizeRowCuts(); i++)
+      binary_ok = u.rowCut(i) == t.rowCut(i) && u.rowCut(i).globallyValid() == t.rowCut(i).globallyValid();
+    for (i = 0; binary_ok && i < t.sizeColCuts(); i++)
+      binary_ok = u.colCut(i) == t.colCut(i) && u.colCut(i).globallyValid() == t.colCut(i).globallyValid();
+    binary_ok = binary_ok && u.rowCut(t.sizeRowCuts()) == rcv[3];
+    OSIUNITTEST_ASSERT_ERROR(binary_ok, {}, "osicuts", "binary files");
+    OSIUNITTEST_ASSERT_ERROR(u.readBinary(fp) == 1, {}, "osicuts", "binary files: end of file");
+
+    // a cut owned elsewhere is owned by the collection it is read into
+    FILE *fpOwned = tmpfile();
+    OSIUNITTEST_ASSERT_ERROR(fpOwned != NULL, return, "osicuts", "binary files");
+    OsiRowCut owned(rcv[3]);
+    owned.setGloballyValidAsInteger(2);
+    OsiRowCut *ownedPtr = &owned;
+    {
+      OsiCuts x;
+      x.insert(ownedPtr);
+      OSIUNITTEST_ASSERT_ERROR(x.writeBinary(fpOwned) == 0, {}, "osicuts", "binary files");
+    }
+    rewind(fpOwned);
+    OsiCuts y;
+    OSIUNITTEST_ASSERT_ERROR(y.readBinary(fpOwned) == 0 && y.sizeRowCuts() == 1, {}, "osicuts", "binary files: owned elsewhere");
+    OSIUNITTEST_ASSERT_ERROR(y.rowCut(0) == rcv[3] && y.rowCut(0).globallyValidAsInteger() == 1, {}, "osicuts", "binary files: owned elsewhere");
+    fclose(fpOwned);
+
+    // from memory, as when the file is mapped
+    std::vector< char > buffer(length);
+    rewind(fp);
+    OSIUNITTEST_ASSERT_ERROR(fread(&buffer[0], 1, length, fp) == static_cast< size_t >(length), {}, "osicuts", "binary files");
+    fclose(fp);
+    OsiCuts v;
+    v.setPackedRowCuts(true);
+    OSIUNITTEST_ASSERT_ERROR(v.readBinary(&buffer[0], buffer.size()) == 0, {}, "osicuts", "binary files: memory");
+    binary_ok = v.sizeRowCuts() == t.sizeRowCuts() && v.sizeColCuts() == t.sizeColCuts();
+    for (i = 0; binary_ok && i < t.sizeRowCuts(); i++)
+      binary_ok = v.rowCut(i) == t.rowCut(i);
+    OSIUNITTEST_ASSERT_ERROR(binary_ok, {}, "osicuts", "binary files: memory");
+    OsiCuts w;
+    OSIUNITTEST_ASSERT_ERROR(w.readBinary(&buffer[0], 30) == 2, {}, "osicuts", "binary files: truncated");
+    buffer[0] = 'X';
+    OSIUNITTEST_ASSERT_ERROR(w.readBinary(&buffer[0], buffer.size()) == 1, {}, "osicuts", "binary files: not a cut file");
+  }
+
   // sorting cuts
   {
     OsiCuts t(rhs);
@@ -0,0 +1,65 @@
+// Copyright (C) 2026, COIN-OR Foundation
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+
+#include "OsiUnitTests.hpp"
+
+#include "OsiSharedPseudoCosts.hpp"
+#include "OsiChooseVariable.hpp"
+
+//--------------------------------------------------------------------------
+void OsiSharedPseudoCostsUnitTest()
+{
+  // Test constructor
+  {
+    OsiSharedPseudoCosts s(3);
+    OSIUNITTEST_ASSERT_ERROR(s.numberObjects() == 3, {}, "osisharedpseudocosts", "constructor");
+    bool zero_ok = true;
+    for (int i = 0; i < 3; i++)
+      zero_ok &= !s.upTotalChange(i) && !s.downTotalChange(i) && !s.upNumber(i) && !s.downNumber(i);
+    OSIUNITTEST_ASSERT_ERROR(zero_ok, {}, "osisharedpseudocosts", "constructor");
+  }
+
+  // Updating, snapshots and merging
+  {
+    OsiSharedPseudoCosts s(3);
+    s.updateInformation(0, 1, 2.0, 0.5, 0);
+    s.updateInformation(0, 1, 2.0, 0.5, 1); // infeasible - ignored
+    OSIUNITTEST_ASSERT_ERROR(s.upTotalChange(0) == 4.0 && s.upNumber(0) == 1, {}, "osisharedpseudocosts", "update");
+    OSIUNITTEST_ASSERT_ERROR(!s.downNumber(0), {}, "osisharedpseudocosts", "update");
+
+    OsiPseudoCosts p;
+    p.setNumberBeforeTrusted(7);
+    s.snapshot(p);
+    OSIUNITTEST_ASSERT_ERROR(p.numberObjects() == 3 && p.numberBeforeTrusted() == 7, {}, "osisharedpseudocosts", "snapshot");
+    OSIUNITTEST_ASSERT_ERROR(p.upTotalChange()[0] == 4.0 && p.upNumber()[0] == 1, {}, "osisharedpseudocosts", "snapshot");
+
+    // only what was learned since the snapshot goes back
+    OsiPseudoCosts base(p);
+    p.updateInformation(1, 0, 1.0, 0.25, 0);
+    s.merge(p, &base);
+    OSIUNITTEST_ASSERT_ERROR(s.downTotalChange(1) == 4.0 && s.downNumber(1) == 1, {}, "osisharedpseudocosts", "merge");
+    OSIUNITTEST_ASSERT_ERROR(s.upTotalChange(0) == 4.0 && s.upNumber(0) == 1, {}, "osisharedpseudocosts", "merge");
+    // without a base everything goes back
+    s.merge(p);
+    OSIUNITTEST_ASSERT_ERROR(s.upNumber(0) == 2 && s.downNumber(1) == 2, {}, "osisharedpseudocosts", "merge");
+
+    s.initialize(1);
+    OSIUNITTEST_ASSERT_ERROR(s.numberObjects() == 1 && !s.upNumber(0), {}, "osisharedpseudocosts", "initialize");
+  }
+
+  // Updates from several threads (if there are any)
+  {
+    OsiSharedPseudoCosts s(2);
+    int i;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (i = 0; i < 1000; i++)
+      s.updateInformation(i & 1, 1, 1.0, 1.0, 0);
+    OSIUNITTEST_ASSERT_ERROR(s.upNumber(0) == 500 && s.upNumber(1) == 500, {}, "osisharedpseudocosts", "concurrent update");
+    OSIUNITTEST_ASSERT_ERROR(s.upTotalChange(0) == 500.0, {}, "osisharedpseudocosts", "concurrent update");
+  }
+}
@@ -83,6 +83,8 @@ If you work on this code, please keep these conventions in mind:
 #include "OsiRowCut.hpp"
 #include "OsiCuts.hpp"
 #include "OsiPresolve.hpp"
+#include "OsiBranchingObject.hpp"
+#include "OsiChooseVariable.hpp"
 
 /*
   Define helper routines in the file-local namespace.
@@ -1397,6 +1399,524 @@ bool test17SebastianNowozin(OsiSolverInterface *si)
   return true;
 }
 
+/*
+  Check that OsiBoundJournal puts back exactly the bounds changed by integer
+  and SOS branches.
+*/
+bool testBoundJournal(OsiSolverInterface *si)
+{
+  CoinPackedMatrix matrix(false, 0, 0);
+  matrix.setDimensions(0, 4);
+  double objective[] = { 1.0, 1.0, 1.0, 1.0 };
+  double varLB[] = { 0.0, 0.0, 0.0, 0.0 };
+  double varUB[] = { 4.0, 4.0, 1.0, 1.0 };
+  si->loadProblem(matrix, varLB, varUB, objective, NULL, NULL);
+
+  OsiBoundJournal journal;
+  OsiSimpleInteger integer(si, 0);
+  OsiIntegerBranchingObject branch(si, &integer, 0, 2.5);
+  branch.branch(si, &journal); // x0 <= 2
+  OSIUNITTEST_ASSERT_ERROR(journal.complete() && journal.numberEntries() == 1, return false, *si, "testBoundJournal");
+  OSIUNITTEST_ASSERT_ERROR(si->getColUpper()[0] == 2.0, return false, *si, "testBoundJournal");
+  journal.restore(si);
+  OSIUNITTEST_ASSERT_ERROR(si->getColUpper()[0] == 4.0 && !journal.numberEntries(), return false, *si, "testBoundJournal");
+  branch.branch(si, &journal); // x0 >= 3
+  OSIUNITTEST_ASSERT_ERROR(si->getColLower()[0] == 3.0, return false, *si, "testBoundJournal");
+  journal.restore(si);
+  OSIUNITTEST_ASSERT_ERROR(si->getColLower()[0] == 0.0 && si->getColUpper()[0] == 4.0, return false, *si, "testBoundJournal");
+
+  int which[] = { 1, 2, 3 };
+  OsiSOS sos(si, 3, which, NULL, 1);
+  OsiSOSBranchingObject sosBranch(si, &sos, 0, 0.5);
+  sosBranch.branch(si, &journal); // x2 and x3 fixed to zero
+  OSIUNITTEST_ASSERT_ERROR(journal.numberEntries() == 2 && si->getColUpper()[3] == 0.0, return false, *si, "testBoundJournal");
+  journal.restore(si);
+  sosBranch.branch(si, &journal); // x1 fixed to zero
+  journal.restore(si);
+  bool bounds_ok = true;
+  for (int j = 0; j < 4; j++)
+    bounds_ok &= si->getColLower()[j] == varLB[j] && si->getColUpper()[j] == varUB[j];
+  OSIUNITTEST_ASSERT_ERROR(bounds_ok, return false, *si, "testBoundJournal");
+
+  // a column recorded twice gets its first bounds back
+  journal.record(si, 2);
+  si->setColUpper(2, 0.5);
+  journal.record(si, 2);
+  si->setColUpper(2, 0.0);
+  journal.restore(si);
+  OSIUNITTEST_ASSERT_ERROR(si->getColUpper()[2] == 1.0, return false, *si, "testBoundJournal");
+  journal.setIncomplete();
+  journal.clear();
+  OSIUNITTEST_ASSERT_ERROR(journal.complete(), return false, *si, "testBoundJournal");
+
+  return true;
+}
+
+/*
+  Load numberColumns integer variables in [0,varUB[j]] and, if elements is
+  given, the one row elements x <= rowUB, then solve.  Used by the chooser
+  tests.
+*/
+void loadIntegerProblem(OsiSolverInterface *si, int numberColumns,
+  const double *objective, const double *varUB,
+  const double *elements = NULL, double rowUB = 0.0, double objSense = 1.0)
+{
+  CoinPackedMatrix matrix(false, 0, 0);
+  matrix.setDimensions(0, numberColumns);
+  std::vector< int > columns(numberColumns);
+  for (int j = 0; j < numberColumns; j++)
+    columns[j] = j;
+  if (elements) {
+    CoinPackedVector row(numberColumns, &columns[0], elements);
+    matrix.appendRow(row);
+  }
+  std::vector< double > varLB(numberColumns, 0.0);
+  double rowLB = -si->getInfinity();
+  si->loadProblem(matrix, &varLB[0], varUB, objective,
+    elements ? &rowLB : NULL, elements ? &rowUB : NULL);
+  si->setObjSense(objSense);
+  for (int j = 0; j < numberColumns; j++)
+    si->setInteger(j);
+  si->findIntegers(false);
+  si->initialSolve();
+}
+
+/*
+  Check that OsiChooseStrong builds the same list with and without
+  incremental list maintenance as the solution and bounds change.
+*/
+bool testIncrementalList(OsiSolverInterface *si)
+{
+  double objective[] = { 1.0, 2.0, 3.0, 4.0 };
+  double varUB[] = { 4.0, 4.0, 4.0, 4.0 };
+  loadIntegerProblem(si, 4, objective, varUB);
+
+  OsiChooseStrong full(si);
+  OsiChooseStrong incremental(si);
+  incremental.setIncrementalList(true);
+  full.setNumberStrong(2);
+  incremental.setNumberStrong(2);
+  double solution[3][4] = { { 0.5, 1.0, 2.5, 3.5 },
+    { 0.5, 1.5, 2.5, 3.0 }, { 0.5, 1.5, 2.5, 3.0 } };
+  bool lists_ok = true;
+  for (int k = 0; k < 3; k++) {
+    if (k == 2)
+      si->setColUpper(3, 3.0); // bounds change, solution does not
+    OsiBranchingInformation info(si, true, false);
+    info.solution_ = solution[k];
+    full.setupList(&info, true);
+    incremental.setupList(&info, true);
+    lists_ok &= full.numberUnsatisfied() == incremental.numberUnsatisfied();
+    lists_ok &= full.numberOnList() == incremental.numberOnList();
+    for (int j = 0; lists_ok && j < full.numberOnList(); j++)
+      lists_ok &= full.candidates()[j] == incremental.candidates()[j];
+  }
+  OSIUNITTEST_ASSERT_ERROR(lists_ok, return false, *si, "testIncrementalList");
+  OSIUNITTEST_ASSERT_ERROR(incremental.numberUnsatisfied() == 3, return false, *si, "testIncrementalList");
+
+  return true;
+}
+
+/*
+  Check the one pivot estimates of OsiChooseStrongPivot on
+  max x0 subject to 2 x0 <= 1, x0 integer in [0,1].  The LP has x0 = 0.5;
+  going down costs 0.5 and going up is infeasible.
+*/
+bool testPivotEstimates(OsiSolverInterface *si)
+{
+  if (si->canDoSimplexInterface() < 1)
+    return true;
+  double objective = 1.0;
+  double varUB = 1.0;
+  double element = 2.0;
+  loadIntegerProblem(si, 1, &objective, &varUB, &element, 1.0, -1.0);
+  OSIUNITTEST_ASSERT_ERROR(si->isProvenOptimal(), return false, *si, "testPivotEstimates");
+
+  OsiChooseStrongPivot choose(si);
+  OsiBranchingInformation info(si, true, false);
+  int which = 0;
+  double down;
+  double up;
+  OSIUNITTEST_ASSERT_ERROR(choose.pivotEstimates(&info, 1, &which, &down, &up) == 0, return false, *si, "testPivotEstimates");
+  OSIUNITTEST_ASSERT_ERROR(fabs(down - 0.5) < 1.0e-7, {}, *si, "testPivotEstimates: down");
+  OSIUNITTEST_ASSERT_ERROR(up == COIN_DBL_MAX, {}, *si, "testPivotEstimates: up infeasible");
+  OSIUNITTEST_ASSERT_ERROR(choose.numberPivotEstimates() == 1, {}, *si, "testPivotEstimates");
+
+  return true;
+}
+
+/*
+  Check that OsiHotInfo::initialize reuses the branching object of a simple
+  integer.
+*/
+bool testHotInfoReuse(OsiSolverInterface *si)
+{
+  double objective[] = { 1.0, 1.0 };
+  double varUB[] = { 4.0, 4.0 };
+  loadIntegerProblem(si, 2, objective, varUB);
+
+  OsiBranchingInformation info(si, true, false);
+  double solution[] = { 1.5, 2.5 };
+  info.solution_ = solution;
+  OsiHotInfo hotInfo(si, &info, si->objects(), 0);
+  const OsiBranchingObject *branch = hotInfo.branchingObject();
+  hotInfo.setDownStatus(0);
+  hotInfo.initialize(si, &info, si->objects(), 1);
+  OSIUNITTEST_ASSERT_ERROR(hotInfo.branchingObject() == branch, return false, *si, "testHotInfoReuse");
+  OSIUNITTEST_ASSERT_ERROR(hotInfo.whichObject() == 1 && hotInfo.downStatus() == -1, return false, *si, "testHotInfoReuse");
+  OSIUNITTEST_ASSERT_ERROR(branch->value() == 2.5 && branch->originalObject() == si->object(1), return false, *si, "testHotInfoReuse");
+
+  return true;
+}
+
+/*
+  Check that OsiChooseStrong reuses strong branching results at the same
+  node, and not after a cut is added.  max x0 + x1 subject to
+  2 x0 + 2 x1 <= 3, x binary has one fractional variable.
+*/
+bool testStrongResultCache(OsiSolverInterface *si)
+{
+  int columns[] = { 0, 1 };
+  double elements[] = { 2.0, 2.0 };
+  double objective[] = { 1.0, 1.0 };
+  double varUB[] = { 1.0, 1.0 };
+  loadIntegerProblem(si, 2, objective, varUB, elements, 3.0, -1.0);
+  OSIUNITTEST_ASSERT_ERROR(si->isProvenOptimal(), return false, *si, "testStrongResultCache");
+
+  OsiChooseStrong choose(si);
+  choose.setNumberStrong(2);
+  choose.setResultCacheSize(2);
+  int best[2];
+  for (int k = 0; k < 2; k++) {
+    OsiBranchingInformation info(si, true, false);
+    OSIUNITTEST_ASSERT_ERROR(choose.setupList(&info, true) == 1, return false, *si, "testStrongResultCache");
+    choose.chooseVariable(si, &info, false);
+    best[k] = choose.bestObjectIndex();
+    OSIUNITTEST_ASSERT_ERROR(choose.numberResultsReused() == k, return false, *si, "testStrongResultCache: reused");
+  }
+  OSIUNITTEST_ASSERT_ERROR(best[0] == best[1], {}, *si, "testStrongResultCache: same choice");
+
+  // a cut makes the results stale
+  CoinPackedVector row(2, columns, elements);
+  si->addRow(row, -si->getInfinity(), 3.0);
+  si->resolve();
+  OsiBranchingInformation info(si, true, false);
+  choose.setupList(&info, true);
+  choose.chooseVariable(si, &info, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberResultsReused() == 1, {}, *si, "testStrongResultCache: stale");
+  choose.clearResultCache();
+  OsiBranchingInformation info2(si, true, false);
+  choose.setupList(&info2, true);
+  choose.chooseVariable(si, &info2, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberResultsReused() == 1, {}, *si, "testStrongResultCache: cleared");
+
+  // so does a row bound change which leaves the objective value alone
+  si->setRowLower(1, -10.0);
+  si->resolve();
+  OsiBranchingInformation info3(si, true, false);
+  choose.setupList(&info3, true);
+  choose.chooseVariable(si, &info3, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberResultsReused() == 1, {}, *si, "testStrongResultCache: row bounds");
+
+  return true;
+}
+
+/*
+  Check the strong branching records of OsiChooseStrong on the problem of
+  testStrongResultCache (x1 = 0.5 is the candidate).
+*/
+bool testStrongRecords(OsiSolverInterface *si)
+{
+  double elements[] = { 2.0, 2.0 };
+  double objective[] = { 1.0, 1.0 };
+  double varUB[] = { 1.0, 1.0 };
+  loadIntegerProblem(si, 2, objective, varUB, elements, 3.0, -1.0);
+  OSIUNITTEST_ASSERT_ERROR(si->isProvenOptimal(), return false, *si, "testStrongRecords");
+
+  OsiChooseStrong choose(si);
+  choose.setNumberStrong(2);
+  choose.setStrongStatistics(true);
+  OsiBranchingInformation info(si, true, false);
+  choose.setupList(&info, true);
+  choose.chooseVariable(si, &info, false);
+  OSIUNITTEST_ASSERT_ERROR(choose.numberStrongRecords() == 1 && choose.numberStrongCalls() == 1, return false, *si, "testStrongRecords");
+  const OsiStrongRecord &record = choose.strongRecord(0);
+  OSIUNITTEST_ASSERT_ERROR(record.call_ == 0 && record.position_ == 0 && record.method_ == 0, {}, *si, "testStrongRecords");
+  OSIUNITTEST_ASSERT_ERROR(record.whichObject_ == choose.bestObjectIndex() && record.value_ == 0.5, {}, *si, "testStrongRecords");
+  OSIUNITTEST_ASSERT_ERROR(record.status_[0] == 0 && record.status_[1] == 0 && record.stop_ == 0, {}, *si, "testStrongRecords");
+  OSIUNITTEST_ASSERT_ERROR(fabs(record.change_[0] - 0.5) < 1.0e-7 && fabs(record.change_[1]) < 1.0e-7, {}, *si, "testStrongRecords");
+
+  FILE *fp = tmpfile();
+  OSIUNITTEST_ASSERT_ERROR(fp != NULL, return false, *si, "testStrongRecords");
+  OSIUNITTEST_ASSERT_ERROR(choose.writeStrongRecordsCsv(fp) == 0, {}, *si, "testStrongRecords: csv");
+  rewind(fp);
+  int numberLines = 0;
+  int c;
+  while ((c = fgetc(fp)) != EOF)
+    numberLines += c == '\n';
+  fclose(fp);
+  OSIUNITTEST_ASSERT_ERROR(numberLines == 2, {}, *si, "testStrongRecords: csv");
+
+  choose.clearStrongRecords();
+  OSIUNITTEST_ASSERT_ERROR(!choose.numberStrongRecords() && !choose.numberStrongCalls(), {}, *si, "testStrongRecords");
+
+  return true;
+}
+
+/*
+  Check bound changes made in a transaction (beginModification() and
+  commitModification()), nested, with a bound changed twice.
+*/
+bool testModification(OsiSolverInterface *si)
+{
+  CoinPackedMatrix matrix(false, 0, 0);
+  matrix.setDimensions(0, 3);
+  int columns[] = { 0, 1, 2 };
+  double elements[] = { 1.0, 1.0, 1.0 };
+  CoinPackedVector row(3, columns, elements);
+  matrix.appendRow(row);
+  matrix.appendRow(row);
+  double objective[] = { 1.0, 1.0, 1.0 };
+  double varLB[] = { 0.0, 0.0, 0.0 };
+  double varUB[] = { 4.0, 4.0, 4.0 };
+  double rowLB[] = { 1.0, 1.0 };
+  double rowUB[] = { 10.0, 10.0 };
+  si->loadProblem(matrix, varLB, varUB, objective, rowLB, rowUB);
+
+  si->beginModification();
+  OSIUNITTEST_ASSERT_ERROR(si->inModification(), return false, *si, "testModification");
+  si->setColLower(0, 1.0);
+  si->setColUpper(0, 3.0);
+  si->setColUpper(1, 2.0);
+  si->beginModification();
+  si->setColBounds(2, 0.5, 1.5);
+  si->setColUpper(1, 2.5); // last value counts
+  si->setRowUpper(1, 5.0);
+  si->commitModification();
+  OSIUNITTEST_ASSERT_ERROR(si->inModification(), return false, *si, "testModification: nested");
+  int indices[] = { 0 };
+  double bounds[] = { 2.0, 6.0 };
+  si->setRowSetBounds(indices, indices + 1, bounds);
+  si->commitModification();
+  OSIUNITTEST_ASSERT_ERROR(!si->inModification(), return false, *si, "testModification");
+
+  const double *lower = si->getColLower();
+  const double *upper = si->getColUpper();
+  OSIUNITTEST_ASSERT_ERROR(lower[0] == 1.0 && upper[0] == 3.0, {}, *si, "testModification: column bounds");
+  OSIUNITTEST_ASSERT_ERROR(lower[1] == 0.0 && upper[1] == 2.5, {}, *si, "testModification: column bounds");
+  OSIUNITTEST_ASSERT_ERROR(lower[2] == 0.5 && upper[2] == 1.5, {}, *si, "testModification: column bounds");
+  const double *rowLower = si->getRowLower();
+  const double *rowUpper = si->getRowUpper();
+  OSIUNITTEST_ASSERT_ERROR(rowLower[0] == 2.0 && rowUpper[0] == 6.0, {}, *si, "testModification: row bounds");
+  OSIUNITTEST_ASSERT_ERROR(rowLower[1] == 1.0 && rowUpper[1] == 5.0, {}, *si, "testModification: row bounds");
+
+  // a set of column bounds in a transaction, then on its own in a node
+  int setIndices[] = { 0, 2 };
+  double setBounds[] = { 0.0, 2.0, 1.0, 1.0 };
+  si->beginModification();
+  si->setColSetBounds(setIndices, setIndices + 2, setBounds);
+  si->commitModification();
+  lower = si->getColLower();
+  upper = si->getColUpper();
+  bool bounds_ok = lower[0] == 0.0 && upper[0] == 2.0 && lower[2] == 1.0 && upper[2] == 1.0;
+  OSIUNITTEST_ASSERT_ERROR(bounds_ok, {}, *si, "testModification: set of column bounds");
+  si->pushNode();
+  double nodeBounds[] = { 1.0, 1.0, 0.0, 3.0 };
+  si->setColSetBounds(setIndices, setIndices + 2, nodeBounds);
+  lower = si->getColLower();
+  upper = si->getColUpper();
+  bounds_ok = lower[0] == 1.0 && upper[0] == 1.0 && lower[2] == 0.0 && upper[2] == 3.0;
+  si->popNode();
+  lower = si->getColLower();
+  upper = si->getColUpper();
+  bounds_ok &= lower[0] == 0.0 && upper[0] == 2.0 && lower[2] == 1.0 && upper[2] == 1.0;
+  OSIUNITTEST_ASSERT_ERROR(bounds_ok, {}, *si, "testModification: set of column bounds");
+
+  return true;
+}
+
+/*
+  Check that popNode() puts back the bounds saved by pushNode(), two
+  levels deep, with a bound changed twice in the inner level.
+*/
+bool testNodeStack(OsiSolverInterface *si)
+{
+  CoinPackedMatrix matrix(false, 0, 0);
+  matrix.setDimensions(0, 3);
+  int columns[] = { 0, 1, 2 };
+  double elements[] = { 1.0, 1.0, 1.0 };
+  CoinPackedVector row(3, columns, elements);
+  matrix.appendRow(row);
+  double objective[] = { 1.0, 1.0, 1.0 };
+  double varLB[] = { 0.0, 0.0, 0.0 };
+  double varUB[] = { 4.0, 4.0, 4.0 };
+  double rowLB = 1.0;
+  double rowUB = 10.0;
+  si->loadProblem(matrix, varLB, varUB, objective, &rowLB, &rowUB);
+  si->initialSolve();
+
+  si->pushNode(true);
+  si->setColLower(0, 1.0);
+  si->setColUpper(0, 3.0);
+  si->setRowUpper(0, 8.0);
+  si->pushNode();
+  OSIUNITTEST_ASSERT_ERROR(si->nodeDepth() == 2, return false, *si, "testNodeStack");
+  si->setColUpper(0, 2.0);
+  si->setColUpper(0, 1.0);
+  si->setColBounds(2, 2.0, 2.0);
+  si->setRowLower(0, 2.0);
+  si->popNode();
+  const double *lower = si->getColLower();
+  const double *upper = si->getColUpper();
+  bool bounds_ok = lower[0] == 1.0 && upper[0] == 3.0 && lower[2] == 0.0 && upper[2] == 4.0;
+  bounds_ok &= si->getRowLower()[0] == 1.0 && si->getRowUpper()[0] == 8.0;
+  OSIUNITTEST_ASSERT_ERROR(bounds_ok, {}, *si, "testNodeStack: pop");
+  si->popNode();
+  lower = si->getColLower();
+  upper = si->getColUpper();
+  bounds_ok = true;
+  for (int j = 0; j < 3; j++)
+    bounds_ok &= lower[j] == 0.0 && upper[j] == 4.0;
+  bounds_ok &= si->getRowLower()[0] == 1.0 && si->getRowUpper()[0] == 10.0;
+  OSIUNITTEST_ASSERT_ERROR(bounds_ok, {}, *si, "testNodeStack: pop");
+  OSIUNITTEST_ASSERT_ERROR(si->nodeDepth() == 0, {}, *si, "testNodeStack");
+
+  // rows added in a node keep their bounds; deleted rows are forgotten
+  si->addRow(row, 0.0, 5.0);
+  si->pushNode();
+  si->setRowUpper(1, 6.0);
+  si->addRow(row, 0.0, 7.0);
+  si->setRowUpper(2, 9.0);
+  int first = 1;
+  if (si->tracksBoundChanges()) {
+    si->setRowLower(0, 3.0);
+    int which = 0;
+    si->deleteRows(1, &which);
+    first = 0;
+  }
+  si->popNode();
+  OSIUNITTEST_ASSERT_ERROR(si->getNumRows() == first + 2, return false, *si, "testNodeStack: added rows");
+  bounds_ok = si->getRowUpper()[first] == 5.0 && si->getRowUpper()[first + 1] == 9.0;
+  OSIUNITTEST_ASSERT_ERROR(bounds_ok, {}, *si, "testNodeStack: added rows");
+
+  // loading a model forgets the nodes of the old one
+  si->pushNode();
+  si->setColUpper(0, 1.0);
+  si->loadProblem(matrix, varLB, varUB, objective, &rowLB, &rowUB);
+  OSIUNITTEST_ASSERT_ERROR(si->nodeDepth() == 0, {}, *si, "testNodeStack: load");
+  si->setColUpper(1, 2.0);
+  si->pushNode();
+  si->popNode();
+  OSIUNITTEST_ASSERT_ERROR(si->getColUpper()[0] == 4.0 && si->getColUpper()[1] == 2.0, {}, *si, "testNodeStack: load");
+
+  return true;
+}
+
+/*
+  Check that the matrix views show the same matrix as getMatrixByRow() and
+  getMatrixByCol().
+*/
+bool testMatrixView(OsiSolverInterface *si)
+{
+  CoinPackedMatrix matrix(false, 0, 0);
+  matrix.setDimensions(0, 3);
+  int columns[] = { 0, 2, 1, 2 };
+  double elements[] = { 1.0, 2.0, -1.0, 3.0 };
+  matrix.appendRow(2, columns, elements);
+  matrix.appendRow(2, columns + 2, elements + 2);
+  double objective[] = { 1.0, 1.0, 1.0 };
+  double varLB[] = { 0.0, 0.0, 0.0 };
+  double varUB[] = { 4.0, 4.0, 4.0 };
+  double rowLB[] = { 1.0, 1.0 };
+  double rowUB[] = { 10.0, 10.0 };
+  si->loadProblem(matrix, varLB, varUB, objective, rowLB, rowUB);
+
+  for (int iWay = 0; iWay < 2; iWay++) {
+    // the view first, so solvers which fill their own arrays do so
+    OsiMatrixView view = iWay ? si->getMatrixViewByCol() : si->getMatrixViewByRow();
+    const CoinPackedMatrix *copy = iWay ? si->getMatrixByCol() : si->getMatrixByRow();
+    OSIUNITTEST_ASSERT_ERROR(!view.isEmpty(), return false, *si, "testMatrixView");
+    bool same = view.isColOrdered() == copy->isColOrdered();
+    same &= view.getMajorDim() == copy->getMajorDim();
+    same &= view.getMinorDim() == copy->getMinorDim();
+    same &= view.getNumElements() == 4;
+    for (int i = 0; same && i < view.getMajorDim(); i++) {
+      CoinShallowPackedVector vector = copy->getVector(i);
+      CoinBigIndex start = view.getVectorStarts()[i];
+      same &= view.getVectorSize(i) == vector.getNumElements();
+      for (int k = 0; same && k < vector.getNumElements(); k++) {
+        // order within a vector may differ
+        int j;
+        for (j = 0; j < vector.getNumElements(); j++) {
+          if (view.getIndices()[start + j] == vector.getIndices()[k])
+            break;
+        }
+        same &= j < vector.getNumElements() && view.getElements()[start + j] == vector.getElements()[k];
+      }
+    }
+    OSIUNITTEST_ASSERT_ERROR(same, {}, *si, "testMatrixView");
+  }
+
+  // a view asked for after a change shows the new matrix
+  CoinPackedVector row(2, columns, elements);
+  si->addRow(row, 1.0, 10.0);
+  OsiMatrixView view = si->getMatrixViewByRow();
+  OSIUNITTEST_ASSERT_ERROR(view.getMajorDim() == 3 && view.getNumElements() == 6, {}, *si, "testMatrixView: after a change");
+  OSIUNITTEST_ASSERT_ERROR(view.getVectorSize(2) == 2, {}, *si, "testMatrixView: after a change");
+
+  return true;
+}
+
+/*
+  Check that changing one part of the model changes only its version.
+  Solvers which keep no versions are not checked.
+*/
+bool testModelVersions(OsiSolverInterface *si)
+{
+  CoinPackedMatrix matrix(false, 0, 0);
+  matrix.setDimensions(0, 2);
+  int columns[] = { 0, 1 };
+  double elements[] = { 1.0, 1.0 };
+  matrix.appendRow(2, columns, elements);
+  double objective[] = { 1.0, 1.0 };
+  double varLB[] = { 0.0, 0.0 };
+  double varUB[] = { 4.0, 4.0 };
+  double rowLB = 1.0;
+  double rowUB = 10.0;
+  si->loadProblem(matrix, varLB, varUB, objective, &rowLB, &rowUB);
+
+  if (!si->tracksModelVersions())
+    return true; // versions tell nothing for this solver
+  unsigned int before[OsiSolverInterface::NumberModelParts];
+  int i;
+  for (i = 0; i < OsiSolverInterface::NumberModelParts; i++)
+    before[i] = si->modelVersion(static_cast< OsiSolverInterface::ModelPart >(i));
+  si->setColLower(0, 1.0);
+  bool versions_ok = si->colBoundsVersion() != before[OsiSolverInterface::ColBoundsPart];
+  versions_ok &= si->rowBoundsVersion() == before[OsiSolverInterface::RowBoundsPart];
+  versions_ok &= si->objectiveVersion() == before[OsiSolverInterface::ObjectivePart];
+  versions_ok &= si->matrixVersion() == before[OsiSolverInterface::MatrixPart];
+  versions_ok &= si->integralityVersion() == before[OsiSolverInterface::IntegralityPart];
+  OSIUNITTEST_ASSERT_ERROR(versions_ok, {}, *si, "testModelVersions: column bounds");
+
+  unsigned int rowBounds = si->rowBoundsVersion();
+  si->setRowUpper(0, 8.0);
+  OSIUNITTEST_ASSERT_ERROR(si->rowBoundsVersion() != rowBounds, {}, *si, "testModelVersions: row bounds");
+  unsigned int objectiveVersion = si->objectiveVersion();
+  si->setObjCoeff(1, 2.0);
+  OSIUNITTEST_ASSERT_ERROR(si->objectiveVersion() != objectiveVersion, {}, *si, "testModelVersions: objective");
+  unsigned int matrixVersion = si->matrixVersion();
+  si->addRow(2, columns, elements, 0.0, 5.0);
+  OSIUNITTEST_ASSERT_ERROR(si->matrixVersion() != matrixVersion, {}, *si, "testModelVersions: matrix");
+
+  // column types follow integrality without a refresh
+  OSIUNITTEST_ASSERT_ERROR(si->getColType()[1] == 0, {}, *si, "testModelVersions: column type");
+  si->setInteger(1);
+  OSIUNITTEST_ASSERT_ERROR(si->getColType()[1] == 2, {}, *si, "testModelVersions: column type");
+
+  return true;
+}
+
 //#############################################################################
 // Routines to test various feature groups
 //#############################################################################
@@ -4615,6 +5135,16 @@ void OsiSolverInterfaceCommonUnitTest(const OsiSolverInterface *emptySi,
     test_functions.push_back(std::pair< TestFunction, const char * >(&test15VivianDeSmedt, "test15VivianDeSmedt"));
     test_functions.push_back(std::pair< TestFunction, const char * >(&test16SebastianNowozin, "test16SebastianNowozin"));
     test_functions.push_back(std::pair< TestFunction, const char * >(&test17SebastianNowozin, "test17SebastianNowozin"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testBoundJournal, "testBoundJournal"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testIncrementalList, "testIncrementalList"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testPivotEstimates, "testPivotEstimates"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testHotInfoReuse, "testHotInfoReuse"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testStrongResultCache, "testStrongResultCache"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testStrongRecords, "testStrongRecords"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testModification, "testModification"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testNodeStack, "testNodeStack"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testMatrixView, "testMatrixView"));
+    test_functions.push_back(std::pair< TestFunction, const char * >(&testModelVersions, "testModelVersions"));
 
     unsigned int i;
     for (i = 0; i < test_functions.size(); ++i) {
@@ -74,6 +74,14 @@ void OsiRowCutDebuggerUnitTest
 OSICOMMONTESTLIB_EXPORT
 void OsiCutsUnitTest();
 
+/** A function that tests the methods in the OsiCutPool class. */
+OSICOMMONTESTLIB_EXPORT
+void OsiCutPoolUnitTest();
+
+/** A function that tests the methods in the OsiSharedPseudoCosts class. */
+OSICOMMONTESTLIB_EXPORT
+void OsiSharedPseudoCostsUnitTest();
+
 /// A namespace so we can define a few `global' variables to use during tests.
 namespace OsiUnitTest {
 
@@ -149,6 +149,23 @@ inline void checkGLPKerror(int err, std::string glpkfuncname,
   return;
 }
 
+/*
+  Glpk type of a row or column with these bounds.
+*/
+inline int glpkBoundType(double lower, double upper, double inf)
+{
+  if (lower == upper)
+    return GLP_FX;
+  else if (lower > -inf && upper < inf)
+    return GLP_DB;
+  else if (lower > -inf)
+    return GLP_LO;
+  else if (upper < inf)
+    return GLP_UP;
+  else
+    return GLP_FR;
+}
+
 } // end file-local namespace
 
 //#############################################################################
@@ -1575,36 +1592,54 @@ bool OGSI::isContinuous(int colNumber) const
 // Row and column copies of the matrix ...
 //-----------------------------------------------------------------------------
 
+/*
+  Fill CoinPackedMatrix style arrays from the model.  glp_get_mat_row fills
+  from index 1, so each vector is read one place up and moved down; one
+  extra place is needed for the last vector.
+*/
+void OGSI::fillMatrix(bool colOrdered, CoinBigIndex *starts, int *lengths,
+  int *indices, double *elements) const
+{
+  LPX *model = getMutableModelPtr();
+  int majorDim = colOrdered ? getNumCols() : getNumRows();
+  CoinBigIndex elem = 0;
+  for (int i = 0; i < majorDim; ++i) {
+    int length = colOrdered
+      ? glp_get_mat_col(model, i + 1, indices + elem, elements + elem)
+      : glp_get_mat_row(model, i + 1, indices + elem, elements + elem);
+    starts[i] = elem;
+    lengths[i] = length;
+    for (int j = 0; j < length; ++j) {
+      // shift down and make indices 0-based
+      indices[elem + j] = indices[elem + j + 1] - 1;
+      elements[elem + j] = elements[elem + j + 1];
+    }
+    elem += length;
+  }
+  starts[majorDim] = elem;
+  assert(elem == getNumElements());
+}
+
 const CoinPackedMatrix *OGSI::getMatrixByRow() const
 {
   if (matrixByRow_ == NULL) {
-    LPX *model = getMutableModelPtr();
+    int nrows = getNumRows();
+    int ncols = getNumCols();
+    CoinBigIndex nelems = getNumElements();
+    double *elements = new double[nelems + 1];
+    int *indices = new int[nelems + 1];
+    CoinBigIndex *starts = new CoinBigIndex[nrows + 1];
+    int *len = new int[nrows];
+    fillMatrix(false, starts, len, indices, elements);
+
+    // Note:  glp_get_mat_row apparently may return the
+    // elements in decreasing order.  This differs from
+    // people's standard expectations but is not an error.
 
     matrixByRow_ = new CoinPackedMatrix();
-    matrixByRow_->transpose(); // converts to row-order
-    matrixByRow_->setDimensions(0, getNumCols());
-
-    int numcols = getNumCols();
-    int *colind = new int[numcols + 1];
-    double *colelem = new double[numcols + 1];
-    int i;
-    for (i = 0; i < getNumRows(); i++) {
-      int colsize = glp_get_mat_row(model, i + 1, colind, colelem);
-      int j;
-      for (j = 1; j <= colsize; j++) {
-        --colind[j];
-      }
-
-      // Note:  glp_get_mat_row apparently may return the
-      // elements in decreasing order.  This differs from
-      // people's standard expectations but is not an error.
-
-      matrixByRow_->appendRow(colsize, colind + 1, colelem + 1);
-    }
-    delete[] colind;
-    delete[] colelem;
-    if (numcols)
-      matrixByRow_->removeGaps();
+    matrixByRow_->assignMatrix(false /* not column ordered */,
+      ncols, nrows, nelems,
+      elements, indices, starts, len);
   }
   return matrixByRow_;
 }
@@ -1614,31 +1649,58 @@ const CoinPackedMatrix *OGSI::getMatrixByRow() const
 const CoinPackedMatrix *OGSI::getMatrixByCol() const
 {
   if (matrixByCol_ == NULL) {
-    LPX *model = getMutableModelPtr();
+    int nrows = getNumRows();
+    int ncols = getNumCols();
+    CoinBigIndex nelems = getNumElements();
+    double *elements = new double[nelems + 1];
+    int *indices = new int[nelems + 1];
+    CoinBigIndex *starts = new CoinBigIndex[ncols + 1];
+    int *len = new int[ncols];
+    fillMatrix(true, starts, len, indices, elements);
 
     matrixByCol_ = new CoinPackedMatrix();
-    matrixByCol_->setDimensions(getNumRows(), 0);
-
-    int numrows = getNumRows();
-    int *rowind = new int[numrows + 1];
-    double *rowelem = new double[numrows + 1];
-    int j;
-    for (j = 0; j < getNumCols(); j++) {
-      int rowsize = glp_get_mat_col(model, j + 1, rowind, rowelem);
-      int i;
-      for (i = 1; i <= rowsize; i++) {
-        --rowind[i];
-      }
-      matrixByCol_->appendCol(rowsize, rowind + 1, rowelem + 1);
-    }
-    delete[] rowind;
-    delete[] rowelem;
-    if (numrows)
-      matrixByCol_->removeGaps();
+    matrixByCol_->assignMatrix(true /* column ordered */,
+      nrows, ncols, nelems,
+      elements, indices, starts, len);
   }
   return matrixByCol_;
 }
 
+//-----------------------------------------------------------------------------
+// Views of the matrix, from the copies if there are any, else filled into
+// arrays kept from one change of the matrix to the next
+//-----------------------------------------------------------------------------
+
+OsiMatrixView OGSI::getMatrixViewByRow() const
+{
+  if (matrixByRow_)
+    return OsiMatrixView(matrixByRow_, matrixVersion());
+  if (!matrixViewByRow_.isFilled()) {
+    int nrows = getNumRows();
+    matrixViewByRow_.reserve(nrows, getNumElements());
+    fillMatrix(false, matrixViewByRow_.starts(), matrixViewByRow_.lengths(),
+      matrixViewByRow_.indices(), matrixViewByRow_.elements());
+    matrixViewByRow_.setFilled(false, nrows, getNumCols(), matrixVersion());
+  }
+  return matrixViewByRow_.view();
+}
+
+//-----------------------------------------------------------------------------
+
+OsiMatrixView OGSI::getMatrixViewByCol() const
+{
+  if (matrixByCol_)
+    return OsiMatrixView(matrixByCol_, matrixVersion());
+  if (!matrixViewByCol_.isFilled()) {
+    int ncols = getNumCols();
+    matrixViewByCol_.reserve(ncols, getNumElements());
+    fillMatrix(true, matrixViewByCol_.starts(), matrixViewByCol_.lengths(),
+      matrixViewByCol_.indices(), matrixViewByCol_.elements());
+    matrixViewByCol_.setFilled(true, ncols, getNumRows(), matrixVersion());
+  }
+  return matrixViewByCol_.view();
+}
+
 //-----------------------------------------------------------------------------
 // Get solver's value for infinity
 //-----------------------------------------------------------------------------
@@ -1966,6 +2028,7 @@ void OGSI::setObjCoeff(int j, double cj)
   the cached reduced cost.
 */
   freeCachedData(OGSI::KEEPCACHED_PROBLEM);
+  modelChanged(ObjectivePart);
   /*
   Push the changed objective down to glpk.
 */
@@ -1984,6 +2047,12 @@ void OGSI::setColLower(int j, double lbj)
 
 {
   /*
+  In a transaction the change is kept and the upper bound is looked up once
+  at commitModification.
+*/
+  if (bufferColBounds(j, &lbj, NULL))
+    return;
+  /*
   Get the upper bound, so we can call setColBounds.  glpk reports 0 for an
   infinite bound, so we need to check the status and possibly correct.
 */
@@ -2037,6 +2106,8 @@ void OGSI::setColLower(int j, double lbj)
 void OGSI::setColUpper(int j, double ubj)
 
 {
+  if (bufferColBounds(j, NULL, &ubj))
+    return;
   /*
   Get the lower bound, so we can call setColBounds.  glpk reports 0 for an
   infinite bound, so we need to check the status and possibly correct.
@@ -2098,27 +2169,18 @@ void OGSI::setColBounds(int j, double lower, double upper)
 
 {
   assert(j >= 0 && j < getNumCols());
+  if (bufferColBounds(j, &lower, &upper))
+    return;
+  trailColBounds(j);
   /*
   Free only the cached solution. Keep the cached structural variables.
 */
   freeCachedData(OGSI::KEEPCACHED_PROBLEM);
+  modelChanged(ColBoundsPart);
   /*
   Figure out what type we should use for glpk.
 */
-  double inf = getInfinity();
-  int type;
-
-  if (lower == upper) {
-    type = GLP_FX;
-  } else if (lower > -inf && upper < inf) {
-    type = GLP_DB;
-  } else if (lower > -inf) {
-    type = GLP_LO;
-  } else if (upper < inf) {
-    type = GLP_UP;
-  } else {
-    type = GLP_FR;
-  }
+  int type = glpkBoundType(lower, upper, getInfinity());
   /*
   Push the bound change down into the solver. 1-based addressing.
 */
@@ -2141,17 +2203,47 @@ void OGSI::setColBounds(int j, double lower, double upper)
 
 //-----------------------------------------------------------------------------
 
+/*
+  As setColBounds for each column, but the cached solution is freed only
+  once.  In a transaction the base class keeps the changes.
+*/
 void OGSI::setColSetBounds(const int *indexFirst,
   const int *indexLast,
   const double *boundList)
 {
-  OsiSolverInterface::setColSetBounds(indexFirst, indexLast, boundList);
+  if (inModification()) {
+    OsiSolverInterface::setColSetBounds(indexFirst, indexLast, boundList);
+    return;
+  }
+  if (indexFirst == indexLast)
+    return;
+  double inf = getInfinity();
+  for (; indexFirst != indexLast; ++indexFirst, boundList += 2) {
+    int j = *indexFirst;
+    assert(j >= 0 && j < getNumCols());
+    double lower = boundList[0];
+    double upper = boundList[1];
+    trailColBounds(j);
+    int statj = glp_get_col_stat(lp_, j + 1);
+    glp_set_col_bnds(lp_, j + 1, glpkBoundType(lower, upper, inf), lower, upper);
+    glp_set_col_stat(lp_, j + 1, statj);
+    if (collower_) {
+      collower_[j] = lower;
+    }
+    if (colupper_) {
+      colupper_[j] = upper;
+    }
+  }
+  freeCachedData(OGSI::KEEPCACHED_PROBLEM);
+  modelChanged(ColBoundsPart);
 }
 
 //-----------------------------------------------------------------------------
 
 void OGSI::setRowLower(int elementIndex, double elementValue)
 {
+  if (bufferRowBounds(elementIndex, &elementValue, NULL))
+    return;
   // Could be in OsiSolverInterfaceImpl.
   double inf = getInfinity();
 
@@ -2182,6 +2274,8 @@ void OGSI::setRowLower(int elementIndex, double elementValue)
 //-----------------------------------------------------------------------------
 void OGSI::setRowUpper(int elementIndex, double elementValue)
 {
+  if (bufferRowBounds(elementIndex, NULL, &elementValue))
+    return;
   // Could be in OsiSolverInterfaceImpl.
   double inf = getInfinity();
 
@@ -2218,29 +2312,19 @@ void OGSI::setRowUpper(int elementIndex, double elementValue)
 
 void OGSI::setRowBounds(int i, double lower, double upper)
 {
+  if (bufferRowBounds(i, &lower, &upper))
+    return;
+  trailRowBounds(i);
   /*
   Free only the row and column solution, keep the cached structural vectors.
 */
   freeCachedData(OGSI::KEEPCACHED_PROBLEM);
+  modelChanged(RowBoundsPart);
   /*
   Figure out the correct row type for glpk and push the change down into the
   solver. 1-based addressing.
 */
-  double inf = getInfinity();
-  int type;
-
-  if (lower == upper) {
-    type = GLP_FX;
-  } else if (lower > -inf && upper < inf) {
-    type = GLP_DB;
-  } else if (lower > -inf) {
-    type = GLP_LO;
-  } else if (upper < inf) {
-    type = GLP_UP;
-  } else {
-    type = GLP_FR;
-  }
-
+  int type = glpkBoundType(lower, upper, getInfinity());
   glp_set_row_bnds(lp_, i + 1, type, lower, upper);
   /*
   Update cached vectors, if they exist.
@@ -2295,6 +2379,7 @@ void OGSI::setContinuous(int index)
 {
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::FREECACHED_COLUMN);
+  modelChanged(IntegralityPart);
   glp_set_col_kind(model, index + 1, GLP_CV);
 }
 
@@ -2305,6 +2390,7 @@ void OGSI::setInteger(int index)
 {
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::FREECACHED_COLUMN);
+  modelChanged(IntegralityPart);
   glp_set_col_kind(model, index + 1, GLP_IV);
   /*
   Temporary hack to correct upper bounds on general integer variables.
@@ -2353,6 +2439,7 @@ void OGSI::setObjSense(double s)
 
 {
   freeCachedData(OGSI::FREECACHED_RESULTS);
+  modelChanged(ObjectivePart);
 
   if (s <= -1.0) {
     glp_set_obj_dir(lp_, GLP_MAX);
@@ -2387,6 +2474,7 @@ void OGSI::setColSolution(const double *cs)
     // Copy in new col solution.
     CoinDisjointCopyN(cs, nc, colsol_);
   }
+  modelChanged(SolutionPart);
 }
 
 //-----------------------------------------------------------------------------
@@ -2413,6 +2501,7 @@ void OGSI::setRowPrice(const double *rs)
     // Copy in new col solution.
     CoinDisjointCopyN(rs, nr, rowsol_);
   }
+  modelChanged(SolutionPart);
 }
 
 //#############################################################################
@@ -2427,6 +2516,9 @@ void OGSI::addCol(const CoinPackedVectorBase &vec,
   //   zeros must be removed prior to calling glp_set_mat_col.
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::KEEPCACHED_ROW);
+  modelChanged(ColBoundsPart);
+  modelChanged(ObjectivePart);
+  modelChanged(IntegralityPart);
 
   glp_add_cols(model, 1);
   int numcols = getNumCols();
@@ -2488,6 +2580,10 @@ void OGSI::deleteCols(const int num, const int *columnIndices)
   int *columnIndicesPlus1 = new int[num + 1];
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::KEEPCACHED_ROW);
+  modelChanged(ColBoundsPart);
+  modelChanged(ObjectivePart);
+  modelChanged(IntegralityPart);
+  trailColsDeleted(num, columnIndices);
 
   for (int i = 0; i < num; i++) {
     columnIndicesPlus1[i + 1] = columnIndices[i] + 1;
@@ -2514,6 +2610,7 @@ void OGSI::addRow(const CoinPackedVectorBase &vec,
 
   LPX *model = getMutableModelPtr();
   freeCachedData(OGSI::KEEPCACHED_COLUMN);
+  modelChanged(RowBoundsPart);
 
   glp_add_rows(model, 1);
   int numrows = getNumRows();
@@ -2593,6 +2690,69 @@ void OGSI::addRows(const int numrows,
 
 //-----------------------------------------------------------------------------
 
+/*
+  Block version used by applyCuts. All rows are created with one call to
+  glp_add_rows and the cached data is dropped once instead of once per row.
+*/
+void OGSI::addRows(const int numrows, const CoinBigIndex *rowStarts,
+  const int *columns, const double *elements,
+  const double *rowlb, const double *rowub)
+{
+  if (numrows <= 0)
+    return;
+  LPX *model = getMutableModelPtr();
+  freeCachedData(OGSI::KEEPCACHED_COLUMN);
+  modelChanged(RowBoundsPart);
+
+  int firstRow = getNumRows();
+  glp_add_rows(model, numrows);
+  double inf = getInfinity();
+  int numcols = getNumCols();
+  int maxLength = 0;
+  int i;
+  for (i = 0; i < numrows; i++) {
+    int length = static_cast< int >(rowStarts[i + 1] - rowStarts[i]);
+    if (length > maxLength)
+      maxLength = length;
+  }
+
+  // For GLPK, we don't want the arrays to start at 0
+  // Also, we need to weed out any 0.0 elements
+  int *indices_adj = new int[1 + maxLength];
+  double *elements_adj = new double[1 + maxLength];
+
+  for (i = 0; i < numrows; i++) {
+    double lower = rowlb ? rowlb[i] : -inf;
+    double upper = rowub ? rowub[i] : inf;
+    glp_set_row_bnds(model, firstRow + i + 1, glpkBoundType(lower, upper, inf),
+      lower, upper);
+
+    int count = 0;
+    for (CoinBigIndex j = rowStarts[i]; j < rowStarts[i + 1]; j++) {
+      if (elements[j] != 0.0) {
+        if (columns[j] + 1 > numcols) {
+          glp_add_cols(model, columns[j] + 1 - numcols);
+          numcols = columns[j] + 1;
+        }
+        count++;
+        elements_adj[count] = elements[j];
+        indices_adj[count] = columns[j] + 1;
+      }
+    }
+    glp_set_mat_row(model, firstRow + i + 1, count, indices_adj, elements_adj);
+  }
+  delete[] indices_adj;
+  delete[] elements_adj;
+
+#if OGSI_TRACK_FRESH > 0
+  std::cout
+    << "OGSI(" << std::hex << this << std::dec
+    << ")::addRows: " << numrows << " new rows." << std::endl;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
 /*
   There's an expectation that a valid basis will be maintained across row
   deletions. Fortunately, glpk will do this automagically as long as we play
@@ -2608,6 +2768,8 @@ void OGSI::deleteRows(const int num, const int *osiIndices)
   Arguably, column results remain valid across row deletion.
 */
   freeCachedData(OGSI::KEEPCACHED_COLUMN);
+  modelChanged(RowBoundsPart);
+  trailRowsDeleted(num, osiIndices);
   /*
   Glpk uses 1-based indexing, so convert the array of indices. While we're
   doing that, delete the row names.
@@ -2662,6 +2824,8 @@ void OGSI::loadProblem(const CoinPackedMatrix &matrix,
   const double *rowlb_parm, const double *rowub_parm)
 
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
 #if OGSI_TRACK_FRESH > 0
   std::cout
     << "OGSI(" << std::hex << this << std::dec << ")::loadProblem."
@@ -2717,6 +2881,7 @@ void OGSI::loadProblem(const CoinPackedMatrix &matrix,
   }
 
   freeCachedData(OGSI::KEEPCACHED_NONE);
+  modelChanged();
 
   double inf = getInfinity();
   int m = matrix.getNumRows();
@@ -2911,7 +3076,10 @@ void OGSI::loadProblem(const int numcols, const int numrows,
   const double *obj,
   const double *rowlb, const double *rowub)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   freeCachedData(OGSI::KEEPCACHED_NONE);
+  modelChanged();
   LPX *model = getMutableModelPtr();
   double inf = getInfinity();
 
@@ -3028,6 +3196,8 @@ void OGSI::writeMps(const char *filename,
 LPX *OGSI::getModelPtr()
 {
   freeCachedResults();
+  // the caller may change anything
+  modelChanged();
   return lp_;
 }
 
@@ -3172,6 +3342,7 @@ void OGSI::applyColCut(const OsiColCut &cc)
     double lower = lbs.getElements()[i];
     double upper = colUb[column];
     if (lower > colLb[column]) {
+      trailColBounds(column);
       // update cached version as well
       collower_[column] = lower;
       if (lower == upper)
@@ -3194,6 +3365,7 @@ void OGSI::applyColCut(const OsiColCut &cc)
     double upper = ubs.getElements()[i];
     double lower = colLb[column];
     if (upper < colUb[column]) {
+      trailColBounds(column);
       // update cached version as well
       colupper_[column] = upper;
       if (lower == upper)
@@ -3210,6 +3382,7 @@ void OGSI::applyColCut(const OsiColCut &cc)
       glp_set_col_bnds(getMutableModelPtr(), column + 1, type, lower, upper);
     }
   }
+  modelChanged(ColBoundsPart);
 #endif
 }
 
@@ -3570,6 +3743,9 @@ void OGSI::freeCachedMatrix()
   delete matrixByCol_;
   matrixByRow_ = NULL;
   matrixByCol_ = NULL;
+  matrixViewByRow_.invalidate();
+  matrixViewByCol_.invalidate();
+  modelChanged(MatrixPart);
 }
 
 //-----------------------------------------------------------------------------
@@ -3591,6 +3767,7 @@ void OGSI::freeCachedResults()
   rowsol_ = NULL;
   redcost_ = NULL;
   rowact_ = NULL;
+  modelChanged(SolutionPart);
 }
 
 //-----------------------------------------------------------------------------
@@ -235,6 +235,12 @@ public:
   /// Get pointer to column-wise copy of matrix
   virtual const CoinPackedMatrix *getMatrixByCol() const;
 
+  /// Get a view of the row-wise matrix (no copy is made if there is one)
+  virtual OsiMatrixView getMatrixViewByRow() const;
+
+  /// Get a view of the column-wise matrix (see getMatrixViewByRow())
+  virtual OsiMatrixView getMatrixViewByCol() const;
+
   /// Get solver's value for infinity
   virtual double getInfinity() const;
   //@}
@@ -370,6 +376,19 @@ public:
     const int *indexLast,
     const double *boundList);
 
+  /** Every bound change is put on the node trail, so pushNode() does
+    	  not copy all bounds */
+  virtual bool tracksBoundChanges() const
+  {
+    return true;
+  }
+
+  /// Every mutator calls modelChanged()
+  virtual bool tracksModelVersions() const
+  {
+    return true;
+  }
+
   /** Set the type of a number of rows simultaneously<br>
     	  The default implementation just invokes setRowType()
     	  over and over again.
@@ -470,6 +489,10 @@ public:
     const CoinPackedVectorBase *const *rows,
     const char *rowsen, const double *rowrhs,
     const double *rowrng);
+  /** Add a block of rows in one go (used by applyCuts) */
+  virtual void addRows(const int numrows, const CoinBigIndex *rowStarts,
+    const int *columns, const double *element,
+    const double *rowlb, const double *rowub);
   /** */
   virtual void deleteRows(const int num, const int *rowIndices);
 
@@ -710,6 +733,8 @@ protected:
   //@{
   /// Apply a row cut. Return true if cut was applied.
   virtual void applyRowCut(const OsiRowCut &rc);
+  /// applyRowCut() only adds the row, so cuts may go to addRows() together
+  virtual bool applyRowCutsWithAddRows() const { return true; }
 
   /** Apply a column cut (bound adjustment). 
       Return true if cut was applied.
@@ -746,6 +771,12 @@ private:
   /// free cached matrices
   void freeCachedMatrix();
 
+  /** Fill CoinPackedMatrix style arrays with the matrix by column (or by
+      row).  \p indices and \p elements need one place more than the
+      number of elements. */
+  void fillMatrix(bool colOrdered, CoinBigIndex *starts, int *lengths,
+    int *indices, double *elements) const;
+
   /// free all cached data (except specified entries, see getLpPtr())
   void freeCachedData(int keepCached = KEEPCACHED_NONE);
 
@@ -902,6 +933,12 @@ private:
 
   /// Pointer to row-wise copy of problem matrix coefficients.
   mutable CoinPackedMatrix *matrixByCol_;
+
+  /// Arrays behind getMatrixViewByRow() when there is no matrixByRow_
+  mutable OsiMatrixViewBuffer matrixViewByRow_;
+
+  /// Arrays behind getMatrixViewByCol() when there is no matrixByCol_
+  mutable OsiMatrixViewBuffer matrixViewByCol_;
   //@}
   //@}
 };
@@ -2610,6 +2610,8 @@ void OsiGrbSolverInterface::loadProblem(const CoinPackedMatrix &matrix,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   debugMessage("OsiGrbSolverInterface::loadProblem(2)(%p, %p, %p, %p, %p, %p, %p)\n",
     (void *)&matrix, (void *)collb, (void *)colub, (void *)obj, (void *)rowsen, (void *)rowrhs, (void *)rowrng);
 
@@ -2818,6 +2820,8 @@ void OsiGrbSolverInterface::loadProblem(const int numcols, const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   debugMessage("OsiGrbSolverInterface::loadProblem(4)(%d, %d, %p, %p, %p, %p, %p, %p, %p, %p, %p)\n",
     numcols, numrows, (void *)start, (void *)index, (void *)value, (void *)collb, (void *)colub, (void *)obj, (void *)rowsen, (void *)rowrhs, (void *)rowrng);
 
@@ -736,6 +736,7 @@ public:
              getNumApplied()
     </ul>
     */
+  using OsiSolverInterface::applyCuts;
   virtual OsiSolverInterface::ApplyCutsReturnCode applyCuts(const OsiCuts &cs,
     double effectivenessLb = 0.0);
 
@@ -4351,6 +4351,8 @@ OsiMskSolverInterface::loadProblem( const CoinPackedMatrix& matrix,
                                     const double* rowrhs,
                                     const double* rowrng )
 {     
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   int nc=matrix.getNumCols();
   int nr=matrix.getNumRows();
 
@@ -4609,6 +4611,8 @@ OsiMskSolverInterface::loadProblem(const int numcols,
                                     const double* rowrhs,
                                     const double* rowrng )
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   #if MSK_OSI_DEBUG_LEVEL > 1
   debugMessage("Begin OsiMskSolverInterface::loadProblem(%d, %d, %p, %p, %p, %p, %p, %p, %p, %p, %p)\n",
      numcols, numrows, (void *)start, (void *)index, (void *)value, (void *)collb, (void *)colub, (void *)obj, (void *)rowsen,(void *)rowrhs, (void *)rowrng);
@@ -724,31 +724,36 @@ bool OsiSpxSolverInterface::isContinuous(int colNumber) const
 // Row and column copies of the matrix ...
 //------------------------------------------------------------------
 
+// Fill CoinPackedMatrix style arrays from the row (or column) vectors
+void OsiSpxSolverInterface::fillMatrix(bool colOrdered, CoinBigIndex *starts,
+  int *lengths, int *indices, double *elements) const
+{
+  int majorDim = colOrdered ? getNumCols() : getNumRows();
+  CoinBigIndex elem = 0;
+  for (int i = 0; i < majorDim; ++i) {
+    const soplex::SVector &vec = colOrdered ? soplex_->colVector(i) : soplex_->rowVector(i);
+    starts[i] = elem;
+    lengths[i] = vec.size();
+    for (int j = 0; j < lengths[i]; ++j, ++elem) {
+      elements[elem] = vec.value(j);
+      indices[elem] = vec.index(j);
+    }
+  }
+  starts[majorDim] = elem;
+  assert(elem == getNumElements());
+}
+
 const CoinPackedMatrix *OsiSpxSolverInterface::getMatrixByRow() const
 {
   if (matrixByRow_ == NULL) {
     int nrows = getNumRows();
     int ncols = getNumCols();
-    int nelems = getNumElements();
+    CoinBigIndex nelems = getNumElements();
     double *elements = new double[nelems];
     int *indices = new int[nelems];
-    int *starts = new int[nrows + 1];
+    CoinBigIndex *starts = new CoinBigIndex[nrows + 1];
     int *len = new int[nrows];
-    int row, i, elem;
-
-    elem = 0;
-    for (row = 0; row < nrows; ++row) {
-      const soplex::SVector &rowvec = soplex_->rowVector(row);
-      starts[row] = elem;
-      len[row] = rowvec.size();
-      for (i = 0; i < len[row]; ++i, ++elem) {
-        assert(elem < nelems);
-        elements[elem] = rowvec.value(i);
-        indices[elem] = rowvec.index(i);
-      }
-    }
-    starts[nrows] = elem;
-    assert(elem == nelems);
+    fillMatrix(false, starts, len, indices, elements);
 
     matrixByRow_ = new CoinPackedMatrix();
     matrixByRow_->assignMatrix(false /* not column ordered */,
@@ -765,26 +770,12 @@ const CoinPackedMatrix *OsiSpxSolverInterface::getMatrixByCol() const
   if (matrixByCol_ == NULL) {
     int nrows = getNumRows();
     int ncols = getNumCols();
-    int nelems = getNumElements();
+    CoinBigIndex nelems = getNumElements();
     double *elements = new double[nelems];
     int *indices = new int[nelems];
-    int *starts = new int[ncols + 1];
+    CoinBigIndex *starts = new CoinBigIndex[ncols + 1];
     int *len = new int[ncols];
-    int col, i, elem;
-
-    elem = 0;
-    for (col = 0; col < ncols; ++col) {
-      const soplex::SVector &colvec = soplex_->colVector(col);
-      starts[col] = elem;
-      len[col] = colvec.size();
-      for (i = 0; i < len[col]; ++i, ++elem) {
-        assert(elem < nelems);
-        elements[elem] = colvec.value(i);
-        indices[elem] = colvec.index(i);
-      }
-    }
-    starts[ncols] = elem;
-    assert(elem == nelems);
+    fillMatrix(true, starts, len, indices, elements);
 
     matrixByCol_ = new CoinPackedMatrix();
     matrixByCol_->assignMatrix(true /* column ordered */,
@@ -794,6 +785,41 @@ const CoinPackedMatrix *OsiSpxSolverInterface::getMatrixByCol() const
   return matrixByCol_;
 }
 
+//------------------------------------------------------------------
+// Views of the matrix, from the copies if there are any, else filled
+// into arrays kept from one change of the matrix to the next
+//------------------------------------------------------------------
+
+OsiMatrixView OsiSpxSolverInterface::getMatrixViewByRow() const
+{
+  if (matrixByRow_)
+    return OsiMatrixView(matrixByRow_, matrixVersion());
+  if (!matrixViewByRow_.isFilled()) {
+    int nrows = getNumRows();
+    matrixViewByRow_.reserve(nrows, getNumElements());
+    fillMatrix(false, matrixViewByRow_.starts(), matrixViewByRow_.lengths(),
+      matrixViewByRow_.indices(), matrixViewByRow_.elements());
+    matrixViewByRow_.setFilled(false, nrows, getNumCols(), matrixVersion());
+  }
+  return matrixViewByRow_.view();
+}
+
+//------------------------------------------------------------------
+
+OsiMatrixView OsiSpxSolverInterface::getMatrixViewByCol() const
+{
+  if (matrixByCol_)
+    return OsiMatrixView(matrixByCol_, matrixVersion());
+  if (!matrixViewByCol_.isFilled()) {
+    int ncols = getNumCols();
+    matrixViewByCol_.reserve(ncols, getNumElements());
+    fillMatrix(true, matrixViewByCol_.starts(), matrixViewByCol_.lengths(),
+      matrixViewByCol_.indices(), matrixViewByCol_.elements());
+    matrixViewByCol_.setFilled(true, ncols, getNumRows(), matrixVersion());
+  }
+  return matrixViewByCol_.view();
+}
+
 //------------------------------------------------------------------
 // Get solver's value for infinity
 //------------------------------------------------------------------
@@ -944,42 +970,101 @@ void OsiSpxSolverInterface::setObjCoeff(int elementIndex, double elementValue)
 {
   soplex_->changeObj(elementIndex, elementValue);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+  modelChanged(ObjectivePart);
 }
 
 void OsiSpxSolverInterface::setColLower(int elementIndex, double elementValue)
 {
+  if (bufferColBounds(elementIndex, &elementValue, NULL))
+    return;
+  trailColBounds(elementIndex);
   soplex_->changeLower(elementIndex, elementValue);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+  modelChanged(ColBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::setColUpper(int elementIndex, double elementValue)
 {
+  if (bufferColBounds(elementIndex, NULL, &elementValue))
+    return;
+  trailColBounds(elementIndex);
   soplex_->changeUpper(elementIndex, elementValue);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+  modelChanged(ColBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::setColBounds(int elementIndex, double lower, double upper)
 {
+  if (bufferColBounds(elementIndex, &lower, &upper))
+    return;
+  trailColBounds(elementIndex);
   soplex_->changeBounds(elementIndex, lower, upper);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+  modelChanged(ColBoundsPart);
+}
+//-----------------------------------------------------------------------------
+void OsiSpxSolverInterface::setColSetBounds(const int *indexFirst,
+  const int *indexLast,
+  const double *boundList)
+{
+  if (inModification()) {
+    OsiSolverInterface::setColSetBounds(indexFirst, indexLast, boundList);
+    return;
+  }
+  // cached data only freed once
+  for (; indexFirst != indexLast; ++indexFirst, boundList += 2) {
+    trailColBounds(*indexFirst);
+    soplex_->changeBounds(*indexFirst, boundList[0], boundList[1]);
+  }
+  freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+  modelChanged(ColBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::setRowLower(int i, double elementValue)
 {
+  if (bufferRowBounds(i, &elementValue, NULL))
+    return;
+  trailRowBounds(i);
   soplex_->changeLhs(i, elementValue);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_ROW);
+  modelChanged(RowBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::setRowUpper(int i, double elementValue)
 {
+  if (bufferRowBounds(i, NULL, &elementValue))
+    return;
+  trailRowBounds(i);
   soplex_->changeRhs(i, elementValue);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_ROW);
+  modelChanged(RowBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::setRowBounds(int elementIndex, double lower, double upper)
 {
+  if (bufferRowBounds(elementIndex, &lower, &upper))
+    return;
+  trailRowBounds(elementIndex);
   soplex_->changeRange(elementIndex, lower, upper);
   freeCachedData(OsiSpxSolverInterface::FREECACHED_ROW);
+  modelChanged(RowBoundsPart);
+}
+//-----------------------------------------------------------------------------
+void OsiSpxSolverInterface::setRowSetBounds(const int *indexFirst,
+  const int *indexLast,
+  const double *boundList)
+{
+  if (inModification()) {
+    OsiSolverInterface::setRowSetBounds(indexFirst, indexLast, boundList);
+    return;
+  }
+  // cached data only freed once
+  for (; indexFirst != indexLast; ++indexFirst, boundList += 2) {
+    trailRowBounds(*indexFirst);
+    soplex_->changeRange(*indexFirst, boundList[0], boundList[1]);
+  }
+  freeCachedData(OsiSpxSolverInterface::FREECACHED_ROW);
+  modelChanged(RowBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::setRowType(int i, char sense, double rightHandSide,
@@ -1002,6 +1087,7 @@ void OsiSpxSolverInterface::setContinuous(int index)
   if (pos >= 0) {
     spxintvars_->remove(pos);
     freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+    modelChanged(IntegralityPart);
   }
 }
 //-----------------------------------------------------------------------------
@@ -1015,6 +1101,7 @@ void OsiSpxSolverInterface::setInteger(int index)
   if (pos < 0) {
     spxintvars_->addIdx(index);
     freeCachedData(OsiSpxSolverInterface::FREECACHED_COLUMN);
+    modelChanged(IntegralityPart);
   }
 }
 //#############################################################################
@@ -1027,6 +1114,7 @@ void OsiSpxSolverInterface::setObjSense(double s)
     else
       soplex_->changeSense(soplex::SPxLP::MAXIMIZE);
     freeCachedData(OsiSpxSolverInterface::FREECACHED_RESULTS);
+    modelChanged(ObjectivePart);
   }
 }
 
@@ -1046,6 +1134,7 @@ void OsiSpxSolverInterface::setColSolution(const double *cs)
       (*colsol_)[col] = cs[col];
   } else
     colsol_ = NULL;
+  modelChanged(SolutionPart);
 }
 
 //-----------------------------------------------------------------------------
@@ -1064,6 +1153,7 @@ void OsiSpxSolverInterface::setRowPrice(const double *rs)
       (*rowsol_)[row] = rs[row];
   } else
     rowsol_ = NULL;
+  modelChanged(SolutionPart);
 }
 
 //#############################################################################
@@ -1078,12 +1168,19 @@ void OsiSpxSolverInterface::addCol(const CoinPackedVectorBase &vec,
   colvec.add(vec.getNumElements(), vec.getIndices(), vec.getElements());
   soplex_->addCol(soplex::LPCol(obj, colvec, colub, collb));
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_ROW);
+  modelChanged(ColBoundsPart);
+  modelChanged(ObjectivePart);
+  modelChanged(IntegralityPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::deleteCols(const int num, const int *columnIndices)
 {
   soplex_->removeCols(const_cast< int * >(columnIndices), num);
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_ROW);
+  modelChanged(ColBoundsPart);
+  modelChanged(ObjectivePart);
+  modelChanged(IntegralityPart);
+  trailColsDeleted(num, columnIndices);
 
   // took from OsiClp for updating names
   int nameDiscipline;
@@ -1121,6 +1218,7 @@ void OsiSpxSolverInterface::addRow(const CoinPackedVectorBase &vec,
   rowvec.add(vec.getNumElements(), vec.getIndices(), vec.getElements());
   soplex_->addRow(soplex::LPRow(rowlb, rowvec, rowub));
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_COLUMN);
+  modelChanged(RowBoundsPart);
 }
 //-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::addRow(const CoinPackedVectorBase &vec,
@@ -1134,10 +1232,34 @@ void OsiSpxSolverInterface::addRow(const CoinPackedVectorBase &vec,
   addRow(vec, rowlb, rowub);
 }
 //-----------------------------------------------------------------------------
+void OsiSpxSolverInterface::addRows(const int numrows,
+  const CoinBigIndex *rowStarts, const int *columns, const double *element,
+  const double *rowlb, const double *rowub)
+{
+  if (numrows <= 0)
+    return;
+  soplex::LPRowSet rowset(numrows, rowStarts[numrows] - rowStarts[0]);
+  soplex::DSVector rowvec;
+  double inf = getInfinity();
+
+  for (int row = 0; row < numrows; ++row) {
+    CoinBigIndex pos = rowStarts[row];
+    rowvec.clear();
+    rowvec.add(static_cast< int >(rowStarts[row + 1] - pos), &(columns[pos]),
+      &(element[pos]));
+    rowset.add(rowlb ? rowlb[row] : -inf, rowvec, rowub ? rowub[row] : inf);
+  }
+  soplex_->addRows(rowset);
+  freeCachedData(OsiSpxSolverInterface::KEEPCACHED_COLUMN);
+  modelChanged(RowBoundsPart);
+}
+//-----------------------------------------------------------------------------
 void OsiSpxSolverInterface::deleteRows(const int num, const int *rowIndices)
 {
   soplex_->removeRows(const_cast< int * >(rowIndices), num);
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_COLUMN);
+  modelChanged(RowBoundsPart);
+  trailRowsDeleted(num, rowIndices);
 
   // took from OsiClp for updating names
   int nameDiscipline;
@@ -1176,6 +1298,8 @@ void OsiSpxSolverInterface::loadProblem(const CoinPackedMatrix &matrix,
   const double *obj,
   const double *rowlb, const double *rowub)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   int ncols = matrix.getNumCols();
   int nrows = matrix.getNumRows();
   const int *length = matrix.getVectorLengths();
@@ -1216,6 +1340,7 @@ void OsiSpxSolverInterface::loadProblem(const CoinPackedMatrix &matrix,
   soplex_->clear();
   spxintvars_->clear();
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_NONE);
+  modelChanged();
 
   if (matrix.isColOrdered()) {
     int row, col, pos;
@@ -1385,6 +1510,8 @@ void OsiSpxSolverInterface::loadProblem(const int numcols, const int numrows,
   const double *obj,
   const double *rowlb, const double *rowub)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   int col, pos;
   soplex::LPColSet colset(numcols, start[numcols]);
   soplex::DSVector colvec;
@@ -1393,6 +1520,7 @@ void OsiSpxSolverInterface::loadProblem(const int numcols, const int numrows,
   soplex_->clear();
   spxintvars_->clear();
   freeCachedData(OsiSpxSolverInterface::KEEPCACHED_NONE);
+  modelChanged();
 
   for (col = 0; col < numcols; ++col) {
     pos = start[col];
@@ -1455,6 +1583,7 @@ int OsiSpxSolverInterface::readMps(const char *filename,
   soplex::SPxLP::SPxSense objsen = soplex_->spxSense();
   int retval = OsiSolverInterface::readMps(filename, extension);
   soplex_->changeSense(objsen);
+  modelChanged(ObjectivePart);
   return retval;
 }
 
@@ -1516,6 +1645,8 @@ OsiSpxSolverInterface::OsiSpxSolverInterface()
   , rowact_(NULL)
   , matrixByRow_(NULL)
   , matrixByCol_(NULL)
+  , matrixViewByRow_()
+  , matrixViewByCol_()
 {
 #if SOPLEX_VERSION >= 220
 #ifndef NDEBUG
@@ -1571,6 +1702,8 @@ OsiSpxSolverInterface::OsiSpxSolverInterface(const OsiSpxSolverInterface &source
   , rowact_(NULL)
   , matrixByRow_(NULL)
   , matrixByCol_(NULL)
+  , matrixViewByRow_()
+  , matrixViewByCol_()
 {
   // Using the copy-constructor of SoPlex did not work, see #113
   *soplex_ = *source.soplex_;
@@ -1595,6 +1728,14 @@ OsiSpxSolverInterface::~OsiSpxSolverInterface()
 soplex::SoPlex *OsiSpxSolverInterface::getLpPtr(int keepCached)
 {
   freeCachedData(keepCached);
+  // the caller may change whatever is not kept
+  if (!(keepCached & OsiSpxSolverInterface::KEEPCACHED_COLUMN)) {
+    modelChanged(ColBoundsPart);
+    modelChanged(ObjectivePart);
+    modelChanged(IntegralityPart);
+  }
+  if (!(keepCached & OsiSpxSolverInterface::KEEPCACHED_ROW))
+    modelChanged(RowBoundsPart);
   return soplex_;
 }
 
@@ -1674,6 +1815,9 @@ void OsiSpxSolverInterface::freeCachedMatrix()
   freeCacheMatrix(matrixByCol_);
   assert(matrixByRow_ == NULL);
   assert(matrixByCol_ == NULL);
+  matrixViewByRow_.invalidate();
+  matrixViewByCol_.invalidate();
+  modelChanged(MatrixPart);
 }
 
 void OsiSpxSolverInterface::freeCachedResults()
@@ -1686,6 +1830,7 @@ void OsiSpxSolverInterface::freeCachedResults()
   rowsol_ = NULL;
   redcost_ = NULL;
   rowact_ = NULL;
+  modelChanged(SolutionPart);
 }
 
 void OsiSpxSolverInterface::freeCachedData(int keepCached)
@@ -232,6 +232,12 @@ public:
   /// Get pointer to column-wise copy of matrix
   virtual const CoinPackedMatrix *getMatrixByCol() const;
 
+  /// Get a view of the row-wise matrix (no copy is made if there is one)
+  virtual OsiMatrixView getMatrixViewByRow() const;
+
+  /// Get a view of the column-wise matrix (see getMatrixViewByRow())
+  virtual OsiMatrixView getMatrixViewByCol() const;
+
   /// Get solver's value for infinity
   virtual double getInfinity() const;
   //@}
@@ -323,19 +329,12 @@ public:
   virtual void setColBounds(int elementIndex,
     double lower, double upper);
 
-#if 0 // we are using the default implementation of OsiSolverInterface
-      /** Set the bounds on a number of columns simultaneously<br>
-    	  The default implementation just invokes <code>setCollower</code> and
-    	  <code>setColupper</code> over and over again.
-    	  @param <code>[indexfirst,indexLast)</code> contains the indices of
-    	         the constraints whose </em>either</em> bound changes
-    	  @param indexList the indices of those variables
-    	  @param boundList the new lower/upper bound pairs for the variables
-      */
-      virtual void setColSetBounds(const int* indexFirst,
-				   const int* indexLast,
-				   const double* boundList);
-#endif
+  /** Set the bounds on a number of columns simultaneously<br>
+    	  SoPlex is changed column by column, but cached data is freed once.
+    	  Inside beginModification() the changes are kept as usual. */
+  virtual void setColSetBounds(const int *indexFirst,
+    const int *indexLast,
+    const double *boundList);
 
   /** Set a single row lower bound<br>
     	  Use -COIN_DBL_MAX for -infinity. */
@@ -355,18 +354,27 @@ public:
   virtual void setRowType(int index, char sense, double rightHandSide,
     double range);
 
-#if 0 // we are using the default implementation of OsiSolverInterface
-      /** Set the bounds on a number of rows simultaneously<br>
-    	  The default implementation just invokes <code>setRowlower</code> and
-    	  <code>setRowupper</code> over and over again.
-    	  @param <code>[indexfirst,indexLast)</code> contains the indices of
-    	         the constraints whose </em>either</em> bound changes
-    	  @param boundList the new lower/upper bound pairs for the constraints
-      */
-      virtual void setRowSetBounds(const int* indexFirst,
-    				   const int* indexLast,
-    				   const double* boundList);
+  /** Set the bounds on a number of rows simultaneously<br>
+    	  SoPlex is changed row by row, but cached data is freed once.
+    	  Inside beginModification() the changes are kept as usual. */
+  virtual void setRowSetBounds(const int *indexFirst,
+    const int *indexLast,
+    const double *boundList);
 
+  /** Every bound change is put on the node trail, so pushNode() does
+    	  not copy all bounds */
+  virtual bool tracksBoundChanges() const
+  {
+    return true;
+  }
+
+  /// Every mutator calls modelChanged()
+  virtual bool tracksModelVersions() const
+  {
+    return true;
+  }
+
+#if 0 // we are using the default implementation of OsiSolverInterface
       /** Set the type of a number of rows simultaneously<br>
     	  The default implementation just invokes <code>setRowtype</code> and
     	  over and over again.
@@ -458,6 +466,12 @@ public:
     const char rowsen, const double rowrhs,
     const double rowrng);
 
+  using OsiSolverInterface::addRows;
+  /** Add a block of rows in one go (used by applyCuts) */
+  virtual void addRows(const int numrows, const CoinBigIndex *rowStarts,
+    const int *columns, const double *element,
+    const double *rowlb, const double *rowub);
+
 #if 0 // we are using the default implementation of OsiSolverInterface
       /** */
       virtual void addRows(const int numrows,
@@ -648,6 +662,8 @@ protected:
   //@{
   /// Apply a row cut. Return true if cut was applied.
   virtual void applyRowCut(const OsiRowCut &rc);
+  /// applyRowCut() only adds the row, so cuts may go to addRows() together
+  virtual bool applyRowCutsWithAddRows() const { return true; }
 
   /** Apply a column cut (bound adjustment). 
       Return true if cut was applied.
@@ -679,6 +695,10 @@ private:
   /// free cached matrices
   void freeCachedMatrix();
 
+  /// Fill CoinPackedMatrix style arrays with the matrix by column (or row)
+  void fillMatrix(bool colOrdered, CoinBigIndex *starts, int *lengths,
+    int *indices, double *elements) const;
+
   /// free all cached data (except specified entries, see getLpPtr())
   void freeCachedData(int keepCached = KEEPCACHED_NONE);
 
@@ -729,6 +749,12 @@ private:
 
   /// Pointer to row-wise copy of problem matrix coefficients.
   mutable CoinPackedMatrix *matrixByCol_;
+
+  /// Arrays behind getMatrixViewByRow() when there is no matrixByRow_
+  mutable OsiMatrixViewBuffer matrixViewByRow_;
+
+  /// Arrays behind getMatrixViewByCol() when there is no matrixByCol_
+  mutable OsiMatrixViewBuffer matrixViewByCol_;
   //@}
   //@}
 };
@@ -1675,6 +1675,8 @@ void OsiXprSolverInterface::loadProblem(const CoinPackedMatrix &matrix,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   freeCachedResults();
   int i;
 
@@ -1888,6 +1890,8 @@ void OsiXprSolverInterface::loadProblem(const int numcols, const int numrows,
   const char *rowsen, const double *rowrhs,
   const double *rowrng)
 {
+  // bounds saved by pushNode() belong to the old model
+  clearNodeStack();
   freeCachedResults();
   int i;
 
@@ -292,6 +292,12 @@ int main (int argc, const char *argv[])
   testingMessage( "Testing OsiCuts\n" );
   OSIUNITTEST_CATCH_ERROR(OsiCutsUnitTest(), {}, "osi", "osicuts unittest");
 
+  testingMessage( "Testing OsiCutPool\n" );
+  OSIUNITTEST_CATCH_ERROR(OsiCutPoolUnitTest(), {}, "osi", "osicutpool unittest");
+
+  testingMessage( "Testing OsiSharedPseudoCosts\n" );
+  OSIUNITTEST_CATCH_ERROR(OsiSharedPseudoCostsUnitTest(), {}, "osi", "osisharedpseudocosts unittest");
+
 /*
   Testing OsiCuts only? A useful option when doing memory access and leak
   checks. Keeps the run time to something reasonable.